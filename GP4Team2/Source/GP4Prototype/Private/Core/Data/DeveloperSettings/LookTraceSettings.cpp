@@ -14,3 +14,23 @@ bool ULookTraceSettings::DoesDrawDebug()
 {
 	return bDrawTraceDebug;
 }
+
+bool ULookTraceSettings::IsCameraTraceCacheEnabled()
+{
+	return bEnableCameraTraceCache;
+}
+
+float ULookTraceSettings::GetCameraTraceCacheLocationTolerance()
+{
+	return CameraTraceCacheLocationTolerance;
+}
+
+float ULookTraceSettings::GetCameraTraceCacheAngleToleranceDegrees()
+{
+	return CameraTraceCacheAngleToleranceDegrees;
+}
+
+int32 ULookTraceSettings::GetCameraTraceCacheMaxFrameAge()
+{
+	return CameraTraceCacheMaxFrameAge;
+}
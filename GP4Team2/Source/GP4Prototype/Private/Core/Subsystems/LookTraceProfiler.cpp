@@ -0,0 +1,134 @@
+#include "Core/Subsystems/LookTraceProfiler.h"
+
+#include "Misc/DateTime.h"
+#include "Misc/FileHelper.h"
+#include "Misc/Paths.h"
+
+namespace LookTraceProfiler
+{
+	const TCHAR* ShapeName(ELookTraceShape Shape)
+	{
+		return Shape == ELookTraceShape::Capsule ? TEXT("Capsule") : TEXT("Sphere");
+	}
+
+	double AverageMicroseconds(const FLookTraceCallerStats& Stats, int32 Frames)
+	{
+		return Frames > 0 ? Stats.TotalMicroseconds / Frames : 0.0;
+	}
+}
+
+void FLookTraceProfiler::StartCapture()
+{
+	Records.Reset();
+	Callers.Reset();
+	DroppedRecords = 0;
+	StartFrame = GFrameCounter;
+	LastFrame = GFrameCounter;
+	bCapturing = true;
+}
+
+void FLookTraceProfiler::StopCapture()
+{
+	if (!bCapturing) return;
+	bCapturing = false;
+	LastFrame = GFrameCounter;
+
+	// fold the last open frame into the peaks
+	for (TPair<FName, FLookTraceCallerStats>& Pair : Callers)
+	{
+		FLookTraceCallerStats& Stats = Pair.Value;
+		Stats.PeakFrameMicroseconds = FMath::Max(Stats.PeakFrameMicroseconds, Stats.CurrentFrameMicroseconds);
+	}
+}
+
+void FLookTraceProfiler::Record(const FLookTraceRecord& Record)
+{
+	if (!bCapturing) return;
+
+	if (Records.Num() < MaxRecords) Records.Add(Record);
+	else ++DroppedRecords;
+
+	FLookTraceCallerStats& Stats = Callers.FindOrAdd(Record.Caller);
+	Stats.Caller = Record.Caller;
+	if (Stats.Traces == 0 || Stats.CurrentFrame != Record.Frame)
+	{
+		Stats.PeakFrameMicroseconds = FMath::Max(Stats.PeakFrameMicroseconds, Stats.CurrentFrameMicroseconds);
+		Stats.CurrentFrameMicroseconds = 0.0;
+		Stats.CurrentFrame = Record.Frame;
+		++Stats.FramesActive;
+	}
+
+	++Stats.Traces;
+	Stats.Hits += FMath::Max(Record.Hits, 0);
+	Stats.TotalMicroseconds += Record.Microseconds;
+	Stats.CurrentFrameMicroseconds += Record.Microseconds;
+}
+
+int32 FLookTraceProfiler::GetNumCapturedFrames() const
+{
+	const uint64 EndFrame = bCapturing ? GFrameCounter : LastFrame;
+	return static_cast<int32>(EndFrame - StartFrame + 1);
+}
+
+void FLookTraceProfiler::GetTopCallers(int32 Count, TArray<FLookTraceCallerStats>& OutCallers) const
+{
+	OutCallers.Reset();
+	Callers.GenerateValueArray(OutCallers);
+
+	// per-caller totals share the frame count, so sorting by total is sorting by per-frame average
+	OutCallers.Sort([](const FLookTraceCallerStats& A, const FLookTraceCallerStats& B)
+	{
+		return A.TotalMicroseconds > B.TotalMicroseconds;
+	});
+	if (Count >= 0 && OutCallers.Num() > Count) OutCallers.SetNum(Count);
+}
+
+FString FLookTraceProfiler::BuildRecordsCsv() const
+{
+	const UEnum* PresetEnum = StaticEnum<ELookTracePreset>();
+	const UEnum* ChannelEnum = StaticEnum<ECollisionChannel>();
+
+	FString Csv = TEXT("Frame,Caller,Preset,Shape,Channel,Length,Radius,Hits,Microseconds");
+	Csv += LINE_TERMINATOR;
+	for (const FLookTraceRecord& Record : Records)
+	{
+		Csv += FString::Printf(TEXT("%llu,%s,%s,%s,%s,%.1f,%.1f,%d,%.3f"),
+			Record.Frame - StartFrame, *Record.Caller.ToString(),
+			*PresetEnum->GetNameStringByValue(static_cast<int64>(Record.Preset)), LookTraceProfiler::ShapeName(Record.Shape),
+			*ChannelEnum->GetNameStringByValue(Record.Channel.GetValue()), Record.Length, Record.Radius, Record.Hits, Record.Microseconds);
+		Csv += LINE_TERMINATOR;
+	}
+	return Csv;
+}
+
+FString FLookTraceProfiler::BuildCallersCsv() const
+{
+	const int32 Frames = GetNumCapturedFrames();
+
+	FString Csv = FString::Printf(TEXT("Caller,Traces,Hits,TotalUs,AvgUsPerFrame,PeakFrameUs,FramesActive,TracesPerFrame (%d frames, %d records dropped)"),
+		Frames, DroppedRecords);
+	Csv += LINE_TERMINATOR;
+
+	TArray<FLookTraceCallerStats> Sorted;
+	GetTopCallers(INDEX_NONE, Sorted);
+	for (const FLookTraceCallerStats& Stats : Sorted)
+	{
+		Csv += FString::Printf(TEXT("%s,%d,%d,%.3f,%.3f,%.3f,%d,%.3f"),
+			*Stats.Caller.ToString(), Stats.Traces, Stats.Hits, Stats.TotalMicroseconds,
+			LookTraceProfiler::AverageMicroseconds(Stats, Frames),
+			FMath::Max(Stats.PeakFrameMicroseconds, Stats.CurrentFrameMicroseconds), Stats.FramesActive,
+			Frames > 0 ? static_cast<double>(Stats.Traces) / Frames : 0.0);
+		Csv += LINE_TERMINATOR;
+	}
+	return Csv;
+}
+
+bool FLookTraceProfiler::ExportCapture(FString& OutPath) const
+{
+	const FString Stamp = FDateTime::Now().ToString();
+	OutPath = FPaths::ProfilingDir() / FString::Printf(TEXT("LookTraceCapture-%s.csv"), *Stamp);
+	const FString CallersPath = FPaths::ProfilingDir() / FString::Printf(TEXT("LookTraceCallers-%s.csv"), *Stamp);
+
+	return FFileHelper::SaveStringToFile(BuildRecordsCsv(), *OutPath)
+		&& FFileHelper::SaveStringToFile(BuildCallersCsv(), *CallersPath);
+}
@@ -1,36 +1,326 @@
 #include "Core/Subsystems/LookTraceSubsystem.h"
 #include "Core/Data/DeveloperSettings/LookTraceSettings.h"
+#include "Debug.h"
+#include "Engine/Engine.h"
+#include "Engine/GameInstance.h"
+#include "Engine/LocalPlayer.h"
+#include "HAL/IConsoleManager.h"
+
+DECLARE_STATS_GROUP(TEXT("LookTrace"), STATGROUP_LookTrace, STATCAT_Advanced);
+DECLARE_DWORD_COUNTER_STAT(TEXT("Camera Trace Cache Hits"), STAT_CameraTraceCacheHits, STATGROUP_LookTrace);
+DECLARE_DWORD_COUNTER_STAT(TEXT("Camera Trace Cache Misses"), STAT_CameraTraceCacheMisses, STATGROUP_LookTrace);
+
+static TAutoConsoleVariable<int32> CVarLookTraceOverlayTopN(
+	TEXT("GP4.LookTrace.OverlayTopN"), 8,
+	TEXT("Rows of the on-screen per-caller trace cost table shown while a trace capture runs. 0 hides it."),
+	ECVF_Default);
+
+namespace LookTraceCapture
+{
+	template <typename FunctorType>
+	void ForEachSubsystem(UWorld* World, FunctorType&& Functor)
+	{
+		UGameInstance* GI = World ? World->GetGameInstance() : nullptr;
+		if (!GI) return;
+
+		for (ULocalPlayer* LocalPlayer : GI->GetLocalPlayers())
+		{
+			if (ULookTraceSubsystem* Subsystem = LocalPlayer ? LocalPlayer->GetSubsystem<ULookTraceSubsystem>() : nullptr)
+			{
+				Functor(*Subsystem);
+			}
+		}
+	}
+
+	// Keys for the overlay lines, clear of the -1 "always add" key
+	constexpr uint64 OverlayKeyBase = 0x4C4B5452;
+}
+
+static FAutoConsoleCommandWithWorld GLookTraceStartCaptureCommand(
+	TEXT("GP4.LookTrace.StartCapture"),
+	TEXT("Records every ULookTraceSubsystem trace (caller, shape, channel, length, hits, time) and shows the top callers on screen"),
+	FConsoleCommandWithWorldDelegate::CreateLambda([](UWorld* World)
+	{
+		LookTraceCapture::ForEachSubsystem(World, [](ULookTraceSubsystem& Subsystem) { Subsystem.StartTraceCapture(); });
+	}));
+
+static FAutoConsoleCommandWithWorld GLookTraceStopCaptureCommand(
+	TEXT("GP4.LookTrace.StopCapture"),
+	TEXT("Stops the trace capture and writes it as CSV to Saved/Profiling"),
+	FConsoleCommandWithWorldDelegate::CreateLambda([](UWorld* World)
+	{
+		LookTraceCapture::ForEachSubsystem(World, [](ULookTraceSubsystem& Subsystem) { Subsystem.StopTraceCapture(); });
+	}));
+
+static FAutoConsoleCommandWithWorld GLookTraceExportCaptureCommand(
+	TEXT("GP4.LookTrace.ExportCapture"),
+	TEXT("Writes the current trace capture as CSV to Saved/Profiling without stopping it"),
+	FConsoleCommandWithWorldDelegate::CreateLambda([](UWorld* World)
+	{
+		LookTraceCapture::ForEachSubsystem(World, [](ULookTraceSubsystem& Subsystem) { Subsystem.ExportTraceCapture(); });
+	}));
+
+ULookTraceSubsystem::ULookTraceSubsystem()
+{
+	// Initialize sets this again; having it from construction lets subsystems created outside a collection (automation
+	// tests) trace as well
+	if (!HasAnyFlags(RF_ClassDefaultObject)) LookTraceSettings = GetMutableDefault<ULookTraceSettings>();
+}
 
 void ULookTraceSubsystem::Initialize(FSubsystemCollectionBase& Collection)
 {
 	Super::Initialize(Collection);
 
 	LookTraceSettings = GetMutableDefault<ULookTraceSettings>();
+
+	AsyncTraceDelegate.BindUObject(this, &ULookTraceSubsystem::OnAsyncTraceDone);
+
+	// pawnless presets until a pawn registers
+	RegisterQueryPresets(nullptr);
 }
 
-FHitResult ULookTraceSubsystem::GetHitResultFromCameraSphereTrace(AController* Controller, float TraceLength, float TraceRadius, ECollisionChannel TraceChannel)
+// Query presets
+void ULookTraceSubsystem::RegisterQueryPresets(const APawn* Pawn)
 {
-	FHitResult Hit;
+	if (bQueryPresetsBuilt && PresetPawn.Get() == Pawn) return;
 
-	if (!LookTraceSettings) return Hit;
+	bQueryPresetsBuilt = true;
+	PresetPawn = Pawn;
+
+	// one stat tag per preset, so the physics query stats and collision analyzer split by purpose
+	PresetParams[static_cast<int32>(ELookTracePreset::Default)]     = FCollisionQueryParams(SCENE_QUERY_STAT(LookTrace_Default), false);
+	PresetParams[static_cast<int32>(ELookTracePreset::PlayerAim)]   = FCollisionQueryParams(SCENE_QUERY_STAT(LookTrace_PlayerAim), false);
+	PresetParams[static_cast<int32>(ELookTracePreset::VaultProbe)]  = FCollisionQueryParams(SCENE_QUERY_STAT(LookTrace_VaultProbe), false);
+	PresetParams[static_cast<int32>(ELookTracePreset::GroundProbe)] = FCollisionQueryParams(SCENE_QUERY_STAT(LookTrace_GroundProbe), false);
+	PresetParams[static_cast<int32>(ELookTracePreset::Melee)]       = FCollisionQueryParams(SCENE_QUERY_STAT(LookTrace_Melee), false);
+
+	for (FCollisionQueryParams& Params : PresetParams)
+	{
+		Params.bReturnPhysicalMaterial = false;
+	}
+
+	if (!Pawn) return;
+
+	// ignore lists, resolved once here instead of per query
+	for (int32 Index = 0; Index < NumQueryPresets; ++Index)
+	{
+		if (Index == static_cast<int32>(ELookTracePreset::Default)) continue;
+		PresetParams[Index].AddIgnoredActor(Pawn);
+	}
+	if (const AActor* PawnOwner = Pawn->GetOwner())
+	{
+		PresetParams[static_cast<int32>(ELookTracePreset::PlayerAim)].AddIgnoredActor(PawnOwner);
+	}
+}
+
+void ULookTraceSubsystem::GetPresetQueryStats(ELookTracePreset Preset, int32& OutQueries, float& OutMilliseconds) const
+{
+	const int32 Index = static_cast<int32>(Preset);
+	if (Index < 0 || Index >= NumQueryPresets)
+	{
+		OutQueries = 0;
+		OutMilliseconds = 0.f;
+		return;
+	}
+
+	OutQueries = PresetStats[Index].Queries;
+	OutMilliseconds = static_cast<float>(FPlatformTime::ToMilliseconds64(PresetStats[Index].Cycles));
+}
+
+void ULookTraceSubsystem::ResetPresetQueryStats()
+{
+	for (FPresetQueryStats& Stats : PresetStats)
+	{
+		Stats = FPresetQueryStats();
+	}
+}
+
+ULookTraceSubsystem::FScopedPresetQuery::FScopedPresetQuery(ULookTraceSubsystem& InSubsystem, ELookTracePreset InPreset, const TCHAR* InEntryPoint,
+	ELookTraceShape InShape, ECollisionChannel InChannel, float InLength, float InRadius)
+	: Params(InSubsystem.PresetParams[FMath::Clamp(static_cast<int32>(InPreset), 0, NumQueryPresets - 1)])
+	, Subsystem(InSubsystem)
+	, Stats(InSubsystem.PresetStats[FMath::Clamp(static_cast<int32>(InPreset), 0, NumQueryPresets - 1)])
+	, Preset(InPreset)
+	, EntryPoint(InEntryPoint)
+	, Shape(InShape)
+	, Channel(InChannel)
+	, Length(InLength)
+	, Radius(InRadius)
+	, StartCycles(FPlatformTime::Cycles64())
+{
+	++Stats.Queries;
+}
+
+ULookTraceSubsystem::FScopedPresetQuery::~FScopedPresetQuery()
+{
+	const uint64 Cycles = FPlatformTime::Cycles64() - StartCycles;
+	Stats.Cycles += Cycles;
+
+	if (!Subsystem.Profiler.IsCapturing()) return;
+
+	FLookTraceRecord Record;
+	Record.Frame = GFrameCounter;
+	Record.Caller = FName(Subsystem.CurrentCaller ? Subsystem.CurrentCaller : EntryPoint);
+	Record.Preset = Preset;
+	Record.Shape = Shape;
+	Record.Channel = Channel;
+	Record.Length = Length;
+	Record.Radius = Radius;
+	Record.Hits = NumHits;
+	Record.Microseconds = FPlatformTime::ToMilliseconds64(Cycles) * 1000.0;
+	Subsystem.Profiler.Record(Record);
+}
+
+// Trace capture
+void ULookTraceSubsystem::StartTraceCapture()
+{
+	Profiler.StartCapture();
+	Debug::Log(TEXT("[LookTrace] Trace capture started"), true, 3.f);
+}
+
+void ULookTraceSubsystem::StopTraceCapture()
+{
+	if (!Profiler.IsCapturing()) return;
+
+	Profiler.StopCapture();
+	ExportTraceCapture();
+}
+
+bool ULookTraceSubsystem::ExportTraceCapture()
+{
+	FString Path;
+	const bool bSaved = Profiler.ExportCapture(Path);
+	if (bSaved)
+	{
+		Debug::Log(FString::Printf(TEXT("[LookTrace] %d traces over %d frames written to %s"), Profiler.GetNumRecords(), Profiler.GetNumCapturedFrames(), *Path), true, 5.f);
+	}
+	else
+	{
+		Debug::LogWarning(FString::Printf(TEXT("[LookTrace] Failed to write trace capture to %s"), *Path), true, 5.f);
+	}
+	return bSaved;
+}
+
+void ULookTraceSubsystem::Tick(float DeltaTime)
+{
+	const int32 TopN = CVarLookTraceOverlayTopN.GetValueOnGameThread();
+	if (TopN <= 0 || !GEngine) return;
+
+	TArray<FLookTraceCallerStats> TopCallers;
+	Profiler.GetTopCallers(TopN, TopCallers);
+	const int32 Frames = Profiler.GetNumCapturedFrames();
+
+	// drawn bottom-up: on-screen messages stack newest first
+	const float Duration = FMath::Max(DeltaTime * 2.f, 0.1f);
+	for (int32 Row = TopCallers.Num() - 1; Row >= 0; --Row)
+	{
+		const FLookTraceCallerStats& Stats = TopCallers[Row];
+		GEngine->AddOnScreenDebugMessage(LookTraceCapture::OverlayKeyBase + Row + 1, Duration, FColor::Yellow,
+			FString::Printf(TEXT("%2d. %-28s %7.1f us/frame  peak %7.1f us  %5.2f traces/frame"), Row + 1, *Stats.Caller.ToString(),
+				Stats.TotalMicroseconds / FMath::Max(Frames, 1), FMath::Max(Stats.PeakFrameMicroseconds, Stats.CurrentFrameMicroseconds),
+				static_cast<double>(Stats.Traces) / FMath::Max(Frames, 1)));
+	}
+	GEngine->AddOnScreenDebugMessage(LookTraceCapture::OverlayKeyBase, Duration, FColor::Orange,
+		FString::Printf(TEXT("LookTrace capture: %d frames, %d traces"), Frames, Profiler.GetNumRecords()));
+}
+
+FHitResult ULookTraceSubsystem::GetHitResultFromCameraSphereTrace(AController* Controller, float TraceLength, float TraceRadius,
+	ECollisionChannel TraceChannel, ELookTracePreset Preset)
+{
+	const FCameraTraceCacheEntry* Entry = TraceFromCamera(Controller, TraceLength, TraceRadius, TraceChannel, Preset);
+	return Entry ? Entry->Hit : FHitResult();
+}
+
+const ULookTraceSubsystem::FCameraTraceCacheEntry* ULookTraceSubsystem::TraceFromCamera(AController* Controller, float TraceLength,
+	float TraceRadius, ECollisionChannel TraceChannel, ELookTracePreset Preset)
+{
+	if (!LookTraceSettings || !Controller) return nullptr;
+	if (const APawn* Pawn = Controller->GetPawn()) RegisterQueryPresets(Pawn);
 
 	//Start and End Locations
 	FVector ViewLocation;
 	FRotator ViewRotation;
 	Controller->GetPlayerViewPoint(ViewLocation, ViewRotation);
+	const FVector ViewDirection = ViewRotation.Vector();
+
+	//Cache lookup
+	const bool bUseCache = LookTraceSettings->IsCameraTraceCacheEnabled();
+	FCameraTraceCacheEntry* Entry = nullptr;
+	if (bUseCache)
+	{
+		const TObjectKey<AController> ControllerKey(Controller);
+		const float LocationTolerance = LookTraceSettings->GetCameraTraceCacheLocationTolerance();
+		const float MinDirectionDot = FMath::Cos(FMath::DegreesToRadians(LookTraceSettings->GetCameraTraceCacheAngleToleranceDegrees()));
+		const uint64 MaxAge = static_cast<uint64>(FMath::Max(0, LookTraceSettings->GetCameraTraceCacheMaxFrameAge()));
+
+		for (FCameraTraceCacheEntry& Candidate : CameraTraceCache)
+		{
+			if (Candidate.Controller != ControllerKey || Candidate.TraceChannel != TraceChannel || Candidate.Preset != Preset) continue;
+			if (Candidate.TraceLength != TraceLength || Candidate.TraceRadius != TraceRadius) continue;
+
+			// Same query; reuse it if it is recent enough and the camera barely moved
+			if (GFrameCounter - Candidate.Frame <= MaxAge
+				&& FVector::DistSquared(Candidate.ViewLocation, ViewLocation) <= FMath::Square(LocationTolerance)
+				&& (Candidate.ViewDirection | ViewDirection) >= MinDirectionDot)
+			{
+				++CameraCacheHits;
+				INC_DWORD_STAT(STAT_CameraTraceCacheHits);
+				return &Candidate;
+			}
+
+			Entry = &Candidate;
+			break;
+		}
+
+		++CameraCacheMisses;
+		INC_DWORD_STAT(STAT_CameraTraceCacheMisses);
+
+		if (!Entry)
+		{
+			if (CameraTraceCache.Num() < MaxCameraCacheEntries)
+			{
+				Entry = &CameraTraceCache.AddDefaulted_GetRef();
+			}
+			else
+			{
+				// Evict the stalest entry
+				Entry = &CameraTraceCache[0];
+				for (FCameraTraceCacheEntry& Candidate : CameraTraceCache)
+				{
+					if (Candidate.Frame < Entry->Frame) Entry = &Candidate;
+				}
+			}
+		}
+	}
+	else
+	{
+		CameraTraceCache.Reset();
+		Entry = &CameraTraceCache.AddDefaulted_GetRef();
+	}
+
+	Entry->Controller = Controller;
+	Entry->TraceChannel = TraceChannel;
+	Entry->TraceLength = TraceLength;
+	Entry->TraceRadius = TraceRadius;
+	Entry->Preset = Preset;
+	Entry->ViewLocation = ViewLocation;
+	Entry->ViewDirection = ViewDirection;
+	Entry->Frame = GFrameCounter;
+
 	FVector StartLocation = ViewLocation;
-	FVector EndLocation = ViewLocation + ViewRotation.Vector() * TraceLength;
+	FVector EndLocation = ViewLocation + ViewDirection * TraceLength;
 	
 	//Sphere, Params
-	FCollisionShape Sphere = FCollisionShape::MakeSphere(TraceRadius);
-	FCollisionQueryParams Params(SCENE_QUERY_STAT(SphereTraceSingle),false);
-	Params.AddIgnoredActor(Controller->GetPawn()->GetOwner());
+	const FCollisionShape Sphere = FCollisionShape::MakeSphere(TraceRadius);
+	FScopedPresetQuery Query(*this, Preset, TEXT("CameraSphere"), ELookTraceShape::Sphere, TraceChannel, TraceLength, TraceRadius);
 
 	//Shoot sphere trace
-	const bool bHit = GetWorld()->SweepSingleByChannel(
-		Hit, StartLocation, EndLocation,
-		FQuat::Identity, TraceChannel, Sphere, Params
+	Entry->Hit = FHitResult();
+	Entry->bHit = GetWorld()->SweepSingleByChannel(
+		Entry->Hit, StartLocation, EndLocation,
+		FQuat::Identity, TraceChannel, Sphere, Query.Params
 	);
+	Query.NumHits = Entry->bHit ? 1 : 0;
 
 	//Debug
 	if (LookTraceSettings->DoesDrawDebug())
@@ -38,20 +328,22 @@ FHitResult ULookTraceSubsystem::GetHitResultFromCameraSphereTrace(AController* C
 		DrawDebugCapsule(
 			GetWorld(), (StartLocation+EndLocation)*0.5f,
 			(EndLocation-StartLocation).Size()*0.5f,TraceRadius,
-			FRotationMatrix::MakeFromZ(ViewRotation.Vector()).ToQuat(),
-			bHit ? FColor::Green : FColor::Red, false, 0.05f
+			FRotationMatrix::MakeFromZ(ViewDirection).ToQuat(),
+			Entry->bHit ? FColor::Green : FColor::Red, false, 0.05f
 		);
 	}
 	
-	return Hit;
+	return Entry;
 }
 
-FHitResult ULookTraceSubsystem::GetHitResultFromPawnForwardSphereTrace(APawn* Pawn, float TraceLength, float TraceRadius, ECollisionChannel TraceChannel)
+FHitResult ULookTraceSubsystem::GetHitResultFromPawnForwardSphereTrace(APawn* Pawn, float TraceLength, float TraceRadius,
+	ECollisionChannel TraceChannel, ELookTracePreset Preset)
 {
 	FHitResult Hit;
 
 	if (!LookTraceSettings) return Hit;
 	if (!Pawn) return Hit;
+	RegisterQueryPresets(Pawn);
 
 	//Start and End Locations
 	FVector Forward = Pawn->GetActorForwardVector();
@@ -62,13 +354,14 @@ FHitResult ULookTraceSubsystem::GetHitResultFromPawnForwardSphereTrace(APawn* Pa
 	
 	//Sphere, Params
 	FCollisionShape Sphere = FCollisionShape::MakeSphere(TraceRadius);
-	FCollisionQueryParams Params(SCENE_QUERY_STAT(SphereTraceSingle),false);
+	FScopedPresetQuery Query(*this, Preset, TEXT("PawnForwardSphere"), ELookTraceShape::Sphere, TraceChannel, TraceLength, TraceRadius);
 
 	//Shoot sphere trace
 	const bool bHit = GetWorld()->SweepSingleByChannel(
 		Hit, StartLocation, EndLocation,
-		FQuat::Identity, TraceChannel, Sphere, Params
+		FQuat::Identity, TraceChannel, Sphere, Query.Params
 	);
+	Query.NumHits = bHit ? 1 : 0;
 
 	//Debug
 	if (LookTraceSettings->DoesDrawDebug())
@@ -85,12 +378,13 @@ FHitResult ULookTraceSubsystem::GetHitResultFromPawnForwardSphereTrace(APawn* Pa
 }
 
 FHitResult ULookTraceSubsystem::GetHitResultFromPawnForwardSphereTraceWithOffset(float ForwardOffset, APawn* Pawn,
-	float TraceLength, float TraceRadius, ECollisionChannel TraceChannel)
+	float TraceLength, float TraceRadius, ECollisionChannel TraceChannel, ELookTracePreset Preset)
 {
 	FHitResult Hit;
 
 	if (!LookTraceSettings) return Hit;
 	if (!Pawn) return Hit;
+	RegisterQueryPresets(Pawn);
 
 	//Start and End Locations
 	FVector Forward = Pawn->GetActorForwardVector();
@@ -101,13 +395,14 @@ FHitResult ULookTraceSubsystem::GetHitResultFromPawnForwardSphereTraceWithOffset
 	
 	//Sphere, Params
 	FCollisionShape Sphere = FCollisionShape::MakeSphere(TraceRadius);
-	FCollisionQueryParams Params(SCENE_QUERY_STAT(SphereTraceSingle),false);
+	FScopedPresetQuery Query(*this, Preset, TEXT("PawnForwardSphereWithOffset"), ELookTraceShape::Sphere, TraceChannel, TraceLength - ForwardOffset, TraceRadius);
 
 	//Shoot sphere trace
 	const bool bHit = GetWorld()->SweepSingleByChannel(
 		Hit, StartLocation, EndLocation,
-		FQuat::Identity, TraceChannel, Sphere, Params
+		FQuat::Identity, TraceChannel, Sphere, Query.Params
 	);
+	Query.NumHits = bHit ? 1 : 0;
 
 	//Debug
 	if (LookTraceSettings->DoesDrawDebug())
@@ -123,12 +418,14 @@ FHitResult ULookTraceSubsystem::GetHitResultFromPawnForwardSphereTraceWithOffset
 	return Hit;
 }
 
-FHitResult ULookTraceSubsystem::GetHitResultFromPawnDownSphereTrace(APawn* Pawn, float TraceLength, float TraceRadius, ECollisionChannel TraceChannel)
+FHitResult ULookTraceSubsystem::GetHitResultFromPawnDownSphereTrace(APawn* Pawn, float TraceLength, float TraceRadius,
+	ECollisionChannel TraceChannel, ELookTracePreset Preset)
 {
 	FHitResult Hit;
 
 	if (!LookTraceSettings) return Hit;
 	if (!Pawn) return Hit;
+	RegisterQueryPresets(Pawn);
 
 	//Start and End Locations
 	FVector Down = FVector(Pawn->GetActorUpVector().X, Pawn->GetActorUpVector().Y, Pawn->GetActorUpVector().Z * -1);
@@ -139,13 +436,14 @@ FHitResult ULookTraceSubsystem::GetHitResultFromPawnDownSphereTrace(APawn* Pawn,
 	
 	//Sphere, Params
 	FCollisionShape Sphere = FCollisionShape::MakeSphere(TraceRadius);
-	FCollisionQueryParams Params(SCENE_QUERY_STAT(SphereTraceSingle),false);
+	FScopedPresetQuery Query(*this, Preset, TEXT("PawnDownSphere"), ELookTraceShape::Sphere, TraceChannel, TraceLength, TraceRadius);
 
 	//Shoot sphere trace
 	const bool bHit = GetWorld()->SweepSingleByChannel(
 		Hit, StartLocation, EndLocation,
-		FQuat::Identity, TraceChannel, Sphere, Params
+		FQuat::Identity, TraceChannel, Sphere, Query.Params
 	);
+	Query.NumHits = bHit ? 1 : 0;
 
 	//Debug
 	if (LookTraceSettings->DoesDrawDebug())
@@ -162,155 +460,289 @@ FHitResult ULookTraceSubsystem::GetHitResultFromPawnDownSphereTrace(APawn* Pawn,
 }
 
 void ULookTraceSubsystem::GetHitResultFromCapsuleSweep(UPrimitiveComponent* BatComp, FVector& CurrentBase,
-	FVector& CurrentTip, FVector& PrevBase, FVector& PrevTip, float Radius, TArray<FHitResult>& OutHits, ECollisionChannel TraceChannel)
+	FVector& CurrentTip, FVector& PrevBase, FVector& PrevTip, float Radius, TArray<FHitResult>& OutHits, ECollisionChannel TraceChannel,
+	ELookTracePreset Preset)
 {
-	// setup
 	OutHits.Reset();
-    if (!BatComp) return;
+	if (!BatComp) return;
 
-    UWorld* World = BatComp->GetWorld();
-    if (!World) return;
+	const AActor* BatOwner = BatComp->GetOwner();
+	if (const APawn* Pawn = Cast<APawn>(BatOwner)) RegisterQueryPresets(Pawn);
+	SweepBlade(Preset, PrevBase, PrevTip, CurrentBase, CurrentTip, Radius, TraceChannel, OutHits, BatOwner);
+}
 
-    FVector AxisVector = CurrentTip - CurrentBase;
-    float Length = AxisVector.Size();
-    if (Length <= 0.01f) return;
+void ULookTraceSubsystem::SweepBlade(ELookTracePreset Preset, const FVector& PrevBase, const FVector& PrevTip,
+	const FVector& CurrentBase, const FVector& CurrentTip, float Radius, ECollisionChannel TraceChannel, TArray<FHitResult>& OutHits,
+	const AActor* IgnoredActor)
+{
+	// setup
+	OutHits.Reset();
 
-    FVector AxisDir = AxisVector / Length;
-    float HalfHeight = Length * 0.5f;
-    FVector PrevMid   = (PrevBase + PrevTip) * 0.5f;
-    FVector CurrentMid= (CurrentBase + CurrentTip) * 0.5f;
+	UWorld* World = GetWorld();
+	if (!World || !LookTraceSettings) return;
 
-	
-    // align capsule along Z
-    FQuat Rot = FRotationMatrix::MakeFromZ(AxisDir).ToQuat();
+	if ((CurrentTip - CurrentBase).SizeSquared() <= FMath::Square(0.01f)) return;
 
-    FCollisionShape Capsule = FCollisionShape::MakeCapsule(Radius, HalfHeight);
+	// the tip travels furthest, so its arc decides how finely the swing is cut
+	const float TipTravel = FVector::Dist(PrevTip, CurrentTip);
+	const int32 WantedSubsteps = FMath::Max(FMath::CeilToInt32(TipTravel / FMath::Max(Radius * 2.f, 1.f)), 1);
+	const int32 Substeps = FMath::Min(WantedSubsteps, MaxBladeSubsteps);
 
-    FCollisionQueryParams Params(SCENE_QUERY_STAT(BatCapsuleSweep), false);
-    Params.AddIgnoredActor(BatComp->GetOwner());
-    Params.bReturnPhysicalMaterial = false;
+	FScopedPresetQuery Query(*this, Preset, TEXT("SweepBlade"), ELookTraceShape::Capsule, TraceChannel, TipTravel, Radius);
+	const bool bDrawDebug = LookTraceSettings->DoesDrawDebug();
 
-    TArray<FHitResult> Hits;
+	// every preset but Default already ignores the registered pawn
+	const bool bPresetIgnores = !IgnoredActor || (Preset != ELookTracePreset::Default && IgnoredActor == PresetPawn.Get());
+	if (!bPresetIgnores)
+	{
+		BladeParams = Query.Params;
+		BladeParams.AddIgnoredActor(IgnoredActor);
+	}
+	const FCollisionQueryParams& Params = bPresetIgnores ? Query.Params : BladeParams;
 
-	
-    // main capsule sweep
-    bool bHit = World->SweepMultiByChannel(
-        Hits,
-        PrevMid,
-        CurrentMid,
-        Rot,
-        TraceChannel,
-        Capsule,
-        Params
-    );
+	// dedup by component: substeps are in swing order, so the first hit seen is the earliest
+	BladeSeenComponents.Reset();
+	auto AddNewHits = [this, &OutHits]()
+	{
+		for (FHitResult& Hit : BladeSweepScratch)
+		{
+			bool bSeen = false;
+			BladeSeenComponents.Add(Hit.GetComponent(), &bSeen);
+			if (!bSeen) OutHits.Add(MoveTemp(Hit));
+		}
+	};
+
+	for (int32 Step = 0; Step < Substeps; ++Step)
+	{
+		const float T0 = static_cast<float>(Step) / Substeps;
+		const float T1 = static_cast<float>(Step + 1) / Substeps;
+
+		const FVector Base0 = FMath::Lerp(PrevBase, CurrentBase, T0);
+		const FVector Tip0  = FMath::Lerp(PrevTip, CurrentTip, T0);
+		const FVector Base1 = FMath::Lerp(PrevBase, CurrentBase, T1);
+		const FVector Tip1  = FMath::Lerp(PrevTip, CurrentTip, T1);
+
+		// capsule spans the blade at the middle of the substep and sweeps between the substep's midpoints
+		const FVector AxisMid = ((Tip0 - Base0) + (Tip1 - Base1)) * 0.5f;
+		const float Length = AxisMid.Size();
+		if (Length <= 0.01f) continue;
+
+		// UE capsule half-heights include the end caps, so Length * 0.5 + Radius keeps the full Radius along the whole
+		// blade and reaches Radius past the base and tip
+		const FQuat Rot = FRotationMatrix::MakeFromZ(AxisMid / Length).ToQuat();
+		const FCollisionShape Capsule = FCollisionShape::MakeCapsule(Radius, Length * 0.5f + Radius);
+		const FVector Mid0 = (Base0 + Tip0) * 0.5f;
+		const FVector Mid1 = (Base1 + Tip1) * 0.5f;
+
+		BladeSweepScratch.Reset();
+		World->SweepMultiByChannel(BladeSweepScratch, Mid0, Mid1, Rot, TraceChannel, Capsule, Params);
+		AddNewHits();
+
+		// debug
+		if (bDrawDebug)
+		{
+			DrawDebugCapsule(World, Mid1, Length * 0.5f + Radius, Radius, Rot,
+				BladeSweepScratch.Num() > 0 ? FColor::Red : FColor::Green, false, 0.05f);
+			DrawDebugLine(World, Mid0, Mid1, FColor::Yellow, false, 0.05f, 0, 1.0f);
+		}
+	}
 
-	
-    // extra sweeps (cause dont wanna miss shit)
-    auto SphereSweep = [&](const FVector& From, const FVector& To)
-    {
-        TArray<FHitResult> LocalHits;
-        World->SweepMultiByChannel(
-            LocalHits,
-            From,
-            To,
-            FQuat::Identity,
-            TraceChannel,
-            FCollisionShape::MakeSphere(Radius),
-            Params
-        );
-        Hits.Append(LocalHits);
-    };
+	// capped: each substep capsule only covers the middle of its stretch of the tip path, so on long swings the tip
+	// skips past targets between substeps. One sphere along the tip's path closes those gaps exactly
+	if (WantedSubsteps > Substeps)
+	{
+		BladeSweepScratch.Reset();
+		World->SweepMultiByChannel(BladeSweepScratch, PrevTip, CurrentTip, FQuat::Identity, TraceChannel,
+			FCollisionShape::MakeSphere(Radius), Params);
+		AddNewHits();
+
+		if (bDrawDebug)
+		{
+			DrawDebugLine(World, PrevTip, CurrentTip, BladeSweepScratch.Num() > 0 ? FColor::Red : FColor::Orange, false, 0.05f, 0, 1.0f);
+		}
+	}
 
-	
-    // cover rotational arcs
-    SphereSweep(PrevTip, CurrentTip);
-    SphereSweep(PrevBase, CurrentBase);
+	Query.NumHits = OutHits.Num();
+}
 
-	
-	// debug
-    if (LookTraceSettings->DoesDrawDebug())
-    {
-        DrawDebugCapsule(World, CurrentMid, HalfHeight, Radius, Rot,
-            bHit ? FColor::Red : FColor::Green, false, 10.0f);
-        DrawDebugLine(World, PrevMid, CurrentMid, FColor::Yellow, false, 0.05f, 0, 1.0f);
-    	
-        DrawDebugLine(World, PrevTip, CurrentTip, FColor::Cyan, false, 0.05f, 0, 1.0f);
-        DrawDebugLine(World, PrevBase, CurrentBase, FColor::Blue, false, 0.05f, 0, 1.0f);
-    }
+FVector ULookTraceSubsystem::GetLocationFromCameraLineTrace(AController* Controller, float TraceLength, float TraceRadius, ECollisionChannel TraceChannel,
+	ELookTracePreset Preset) //gotta make this a line, not a sphere
+{
+	const FCameraTraceCacheEntry* Entry = TraceFromCamera(Controller, TraceLength, TraceRadius, TraceChannel, Preset);
+	return Entry ? Entry->Hit.Location : FVector::ZeroVector;
+}
 
-	
-    // combine
-    if (Hits.Num() > 0)
-        OutHits = MoveTemp(Hits);
+TArray<FHitResult> ULookTraceSubsystem::GetHitResultFromLocationWithDirectionSphereTrace(FVector Forward, FVector StartLocation, float TraceLength,
+	float TraceRadius, ECollisionChannel TraceChannel, ELookTracePreset Preset)
+{
+	TArray<FHitResult> Hits;
+	SphereTraceFromLocationWithDirection(Forward, StartLocation, TraceLength, TraceRadius, TraceChannel, Preset, Hits);
+	return Hits;
 }
 
-FVector ULookTraceSubsystem::GetLocationFromCameraLineTrace(AController* Controller, float TraceLength, float TraceRadius, ECollisionChannel TraceChannel) //gotta make this a line, not a sphere
+bool ULookTraceSubsystem::SphereTraceFromLocationWithDirection(const FVector& Forward, const FVector& StartLocation, float TraceLength,
+	float TraceRadius, ECollisionChannel TraceChannel, ELookTracePreset Preset, FTraceHitBuffer& OutHits)
 {
-	FHitResult Hit;
+	OutHits.Reset();
 
-	if (!LookTraceSettings) return FVector::ZeroVector;
+	UWorld* World = GetWorld();
+	if (!World) return false;
 
 	//Start and End Locations
-	FVector ViewLocation;
-	FRotator ViewRotation;
-	Controller->GetPlayerViewPoint(ViewLocation, ViewRotation);
-	FVector StartLocation = ViewLocation;
-	FVector EndLocation = ViewLocation + ViewRotation.Vector() * TraceLength;
+	const FVector ResultTraceDir = Forward.GetSafeNormal();
+	const FVector EndLocation = StartLocation + (ResultTraceDir * TraceLength);
 	
 	//Sphere, Params
-	FCollisionShape Sphere = FCollisionShape::MakeSphere(TraceRadius);
-	FCollisionQueryParams Params(SCENE_QUERY_STAT(SphereTraceSingle),false);
+	const FCollisionShape Sphere = FCollisionShape::MakeSphere(TraceRadius);
+	FScopedPresetQuery Query(*this, Preset, TEXT("LocationSphereMulti"), ELookTraceShape::Sphere, TraceChannel, TraceLength, TraceRadius);
 
 	//Shoot sphere trace
-	const bool bHit = GetWorld()->SweepSingleByChannel(
-		Hit, StartLocation, EndLocation,
-		FQuat::Identity, TraceChannel, Sphere, Params
+	const bool bHit = World->SweepMultiByChannel(
+		OutHits, StartLocation, EndLocation,
+		FQuat::Identity, TraceChannel, Sphere, Query.Params
 	);
+	Query.NumHits = OutHits.Num();
 
 	//Debug
-	if (LookTraceSettings->DoesDrawDebug())
+	if (LookTraceSettings && LookTraceSettings->DoesDrawDebug())
 	{
 		DrawDebugCapsule(
-			GetWorld(), (StartLocation+EndLocation)*0.5f,
+			World, (StartLocation+EndLocation)*0.5f,
 			(EndLocation-StartLocation).Size()*0.5f,TraceRadius,
-			FRotationMatrix::MakeFromZ(ViewRotation.Vector()).ToQuat(),
-			bHit ? FColor::Green : FColor::Red, false, 0.05f
+			FRotationMatrix::MakeFromZ(ResultTraceDir).ToQuat(),
+			bHit ? FColor::Green : FColor::Red, false, 5.0f
 		);
 	}
 
-	return Hit.Location;
+	return bHit;
 }
 
-TArray<FHitResult> ULookTraceSubsystem::GetHitResultFromLocationWithDirectionSphereTrace(FVector Forward, FVector StartLocation, float TraceLength, float TraceRadius, ECollisionChannel TraceChannel)
+// Async
+namespace LookTraceAsync
 {
-	TArray<FHitResult> Hits;
+	// Results nobody consumed within this many frames are dropped
+	constexpr uint64 StaleFrames = 4;
+	constexpr int32 PruneThreshold = 32;
+}
 
-	if (!LookTraceSettings) return Hits;
+FLookTraceHandle ULookTraceSubsystem::RequestCameraSphereTraceAsync(AController* Controller, float TraceLength, float TraceRadius,
+	ECollisionChannel TraceChannel, ELookTracePreset Preset)
+{
+	if (!Controller) return FLookTraceHandle();
+	if (const APawn* Pawn = Controller->GetPawn()) RegisterQueryPresets(Pawn);
 
-	//Start and End Locations
-	FVector ResultTraceDir = Forward.GetSafeNormal();
-	FVector EndLocation = StartLocation + (ResultTraceDir * TraceLength);
-	
-	//Sphere, Params
-	FCollisionShape Sphere = FCollisionShape::MakeSphere(TraceRadius);
-	FCollisionQueryParams Params(SCENE_QUERY_STAT(SphereTraceSingle),false);
+	FVector ViewLocation;
+	FRotator ViewRotation;
+	Controller->GetPlayerViewPoint(ViewLocation, ViewRotation);
 
-	//Shoot sphere trace
-	const bool bHit = GetWorld()->SweepMultiByChannel(
-		Hits, StartLocation, EndLocation,
-		FQuat::Identity, TraceChannel, Sphere, Params
-	);
+	return RequestSphereSweepAsync(ViewLocation, ViewLocation + ViewRotation.Vector() * TraceLength, TraceRadius, TraceChannel, Preset);
+}
+
+FLookTraceHandle ULookTraceSubsystem::RequestPawnForwardSphereTraceAsync(APawn* Pawn, float TraceLength, float TraceRadius,
+	ECollisionChannel TraceChannel, ELookTracePreset Preset, float ForwardOffset)
+{
+	if (!Pawn) return FLookTraceHandle();
+	RegisterQueryPresets(Pawn);
+
+	const FVector Forward = Pawn->GetActorForwardVector().GetSafeNormal();
+	const FVector StartLocation = Pawn->GetActorLocation() + Forward * ForwardOffset;
+	const FVector EndLocation = Pawn->GetActorLocation() + Forward * TraceLength;
+	return RequestSphereSweepAsync(StartLocation, EndLocation, TraceRadius, TraceChannel, Preset);
+}
+
+FLookTraceHandle ULookTraceSubsystem::RequestPawnDownSphereTraceAsync(APawn* Pawn, float TraceLength, float TraceRadius,
+	ECollisionChannel TraceChannel, ELookTracePreset Preset)
+{
+	if (!Pawn) return FLookTraceHandle();
+	RegisterQueryPresets(Pawn);
+
+	const FVector Up = Pawn->GetActorUpVector();
+	const FVector Down = FVector(Up.X, Up.Y, -Up.Z).GetSafeNormal();
+	return RequestSphereSweepAsync(Pawn->GetActorLocation(), Pawn->GetActorLocation() + Down * TraceLength, TraceRadius, TraceChannel, Preset);
+}
+
+FLookTraceHandle ULookTraceSubsystem::RequestSphereSweepAsync(const FVector& Start, const FVector& End, float TraceRadius,
+	ECollisionChannel TraceChannel, ELookTracePreset Preset)
+{
+	UWorld* World = GetWorld();
+	if (!World || !LookTraceSettings) return FLookTraceHandle();
+
+	if (AsyncTraces.Num() > LookTraceAsync::PruneThreshold) PruneStaleAsyncTraces();
+
+	FLookTraceHandle Handle;
+	Handle.Id = NextAsyncTraceId++;
+	if (NextAsyncTraceId <= 0) NextAsyncTraceId = 1;
+
+	FPendingAsyncTrace& Pending = AsyncTraces.Add(Handle.Id);
+	Pending.RequestFrame = GFrameCounter;
+
+	FScopedPresetQuery Query(*this, Preset, TEXT("AsyncSphere"), ELookTraceShape::Sphere, TraceChannel, FVector::Dist(Start, End), TraceRadius);
+
+	World->AsyncSweepByChannel(EAsyncTraceType::Single, Start, End, FQuat::Identity, TraceChannel,
+		FCollisionShape::MakeSphere(TraceRadius), Query.Params, FCollisionResponseParams::DefaultResponseParam,
+		&AsyncTraceDelegate, static_cast<uint32>(Handle.Id));
+	Query.NumHits = INDEX_NONE;
 
-	//Debug
 	if (LookTraceSettings->DoesDrawDebug())
 	{
 		DrawDebugCapsule(
-			GetWorld(), (StartLocation+EndLocation)*0.5f,
-			(EndLocation-StartLocation).Size()*0.5f,TraceRadius,
-			FRotationMatrix::MakeFromZ(ResultTraceDir).ToQuat(),
-			bHit ? FColor::Green : FColor::Red, false, 5.0f
+			World, (Start+End)*0.5f,
+			(End-Start).Size()*0.5f, TraceRadius,
+			FRotationMatrix::MakeFromZ((End-Start).GetSafeNormal()).ToQuat(),
+			FColor::Orange, false, 0.05f
 		);
 	}
 
-	return Hits;
-}
\ No newline at end of file
+	return Handle;
+}
+
+bool ULookTraceSubsystem::IsAsyncTraceReady(const FLookTraceHandle& Handle) const
+{
+	const FPendingAsyncTrace* Pending = AsyncTraces.Find(Handle.Id);
+	return Pending && Pending->bDone;
+}
+
+bool ULookTraceSubsystem::ConsumeAsyncTrace(FLookTraceHandle& Handle, FHitResult& OutHit)
+{
+	FPendingAsyncTrace* Pending = AsyncTraces.Find(Handle.Id);
+	if (!Pending)
+	{
+		// Pruned or never issued; the caller should simply request again
+		Handle.Invalidate();
+		return false;
+	}
+	if (!Pending->bDone) return false;
+
+	OutHit = MoveTemp(Pending->Hit);
+	AsyncTraces.Remove(Handle.Id);
+	Handle.Invalidate();
+	return true;
+}
+
+void ULookTraceSubsystem::CancelAsyncTrace(FLookTraceHandle& Handle)
+{
+	// A result still in flight finds no slot and is dropped in OnAsyncTraceDone
+	AsyncTraces.Remove(Handle.Id);
+	Handle.Invalidate();
+}
+
+void ULookTraceSubsystem::OnAsyncTraceDone(const FTraceHandle& TraceHandle, FTraceDatum& TraceDatum)
+{
+	FPendingAsyncTrace* Pending = AsyncTraces.Find(static_cast<int32>(TraceDatum.UserData));
+	if (!Pending) return;
+
+	// Single traces report at most one (blocking) hit
+	Pending->Hit = TraceDatum.OutHits.Num() > 0 ? TraceDatum.OutHits[0] : FHitResult();
+	Pending->bDone = true;
+}
+
+void ULookTraceSubsystem::PruneStaleAsyncTraces()
+{
+	for (auto It = AsyncTraces.CreateIterator(); It; ++It)
+	{
+		if (GFrameCounter - It.Value().RequestFrame > LookTraceAsync::StaleFrames)
+		{
+			It.RemoveCurrent();
+		}
+	}
+}
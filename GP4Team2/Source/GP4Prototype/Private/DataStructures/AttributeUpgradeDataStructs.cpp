@@ -1 +1,14 @@
 ﻿#include "DataStructures/AttributeUpgradeDataStructs.h"
+
+void FAttribute::RebuildAggregates(int32 FromIndex)
+{
+	FromIndex = FMath::Clamp(FromIndex, 0, FMath::Min(Aggregates.Num(), ActiveModifiers.Num()));
+	Aggregates.SetNum(FromIndex, EAllowShrinking::No);
+
+	FAttributeAggregate Running = GetAggregate();
+	for (int32 Index = FromIndex; Index < ActiveModifiers.Num(); ++Index)
+	{
+		Running.Fold(ActiveModifiers[Index]);
+		Aggregates.Add(Running);
+	}
+}
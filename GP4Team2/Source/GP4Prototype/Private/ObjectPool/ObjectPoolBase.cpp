@@ -3,18 +3,38 @@
 
 #include "ObjectPool/ObjectPoolBase.h"
 
+#include "ObjectPool/ObjectPoolStats.h"
+#include "ObjectPool/PooledActorComponent.h"
+
+DEFINE_STAT(STAT_PoolAcquire);
+DEFINE_STAT(STAT_PoolRelease);
+DEFINE_STAT(STAT_PoolGrow);
+DEFINE_STAT(STAT_PoolWarmUp);
+DEFINE_STAT(STAT_PoolAcquireCount);
+DEFINE_STAT(STAT_PoolMissCount);
+DEFINE_STAT(STAT_PoolFallbackSpawnCount);
+DEFINE_STAT(STAT_PoolActiveActors);
+
 void UObjectPoolBase::InitializePool(TSubclassOf<AActor> InClass, int32 InSize)
 {
+	InitializePoolWithPolicy(InClass, InSize, FPoolGrowthPolicy());
+}
+
+void UObjectPoolBase::InitializePoolWithPolicy(TSubclassOf<AActor> InClass, int32 InSize, const FPoolGrowthPolicy& InPolicy)
+{
+	GrowthPolicy = InPolicy;
 	PooledClass = InClass;
 	InitialSizeCached = InSize;
+	BaseSize = InSize;
 	CachedWorld = GetWorld();
 	if (PoolInstance)
 	{
 		delete PoolInstance;
 		PoolInstance = nullptr;
 	}
-	PoolInstance = new TObjectPool<AActor>(CachedWorld.Get(), InClass, InSize, this);
-	SyncGCProtection();
+	// Time-sliced pools start empty and fill up through TickWarmUp
+	PendingSpawns = GrowthPolicy.bTimeSliced ? InSize : 0;
+	PoolInstance = CreatePoolInstance(GrowthPolicy.bTimeSliced ? 0 : InSize);
 }
 
 void UObjectPoolBase::RebuildPoolForWorldChange()
@@ -30,18 +50,72 @@ void UObjectPoolBase::RebuildPoolForWorldChange()
 		delete PoolInstance;
 		PoolInstance = nullptr;
 	}
-	GCProtectedPool.Empty();
 	CachedWorld = CurrentWorld;
+
+	// A new world is a floor transition: don't carry the old spike over when trimming is on
+	if (TrimPolicy.bEnabled)
+	{
+		InitialSizeCached = BaseSize;
+		ActiveWatermark = 0;
+	}
 	if (!CachedWorld.Get() || !PooledClass)
 	{
 		return; // cannot rebuild
 	}
-	PoolInstance = new TObjectPool<AActor>(CachedWorld.Get(), PooledClass, InitialSizeCached, this);
-	SyncGCProtection();
+	PendingSpawns = GrowthPolicy.bTimeSliced ? InitialSizeCached : 0;
+	PoolInstance = CreatePoolInstance(GrowthPolicy.bTimeSliced ? 0 : InitialSizeCached);
+}
+
+TObjectPool<AActor>* UObjectPoolBase::CreatePoolInstance(int32 InSize)
+{
+	return new TObjectPool<AActor>(CachedWorld.Get(), PooledClass, InSize, this,
+		[this](AActor* Actor, int32 Slot) { OnActorSpawned(Actor, Slot); });
+}
+
+void UObjectPoolBase::OnActorSpawned(AActor* Actor, int32 Slot)
+{
+	UPooledActorComponent* PooledComp = NewObject<UPooledActorComponent>(Actor);
+	PooledComp->Bind(this, Slot);
+	Actor->AddInstanceComponent(PooledComp);
+	PooledComp->RegisterComponent();
+	if (IPoolable* Poolable = Cast<IPoolable>(Actor)) Poolable->SetPooledComponent(PooledComp);
+
+	// All actors of the class look alike, one measurement is enough for the memory budget
+	if (EstimatedBytesPerActor == 0)
+	{
+		EstimatedBytesPerActor = EstimateActorBytes(Actor);
+	}
+}
+
+int64 UObjectPoolBase::EstimateActorBytes(AActor* Actor)
+{
+	FResourceSizeEx ResourceSize(EResourceSizeMode::Exclusive);
+	Actor->GetResourceSizeEx(ResourceSize);
+	int64 Bytes = Actor->GetClass()->GetStructureSize();
+	for (UActorComponent* Component : Actor->GetComponents())
+	{
+		if (!Component) continue;
+		Component->GetResourceSizeEx(ResourceSize);
+		Bytes += Component->GetClass()->GetStructureSize();
+	}
+	return FMath::Max<int64>(1, Bytes + ResourceSize.GetTotalMemoryBytes());
+}
+
+int32 UObjectPoolBase::GetMaxActorsForBudget() const
+{
+	if (!TrimPolicy.bEnabled || TrimPolicy.MemoryBudgetKB <= 0 || EstimatedBytesPerActor <= 0)
+	{
+		return MAX_int32;
+	}
+	return static_cast<int32>(FMath::Min<int64>(MAX_int32, TrimPolicy.MemoryBudgetKB * 1024ll / EstimatedBytesPerActor));
 }
 
 AActor* UObjectPoolBase::AcquireActor()
 {
+	SCOPE_CYCLE_COUNTER(STAT_PoolAcquire);
+	INC_DWORD_STAT(STAT_PoolAcquireCount);
+	const uint64 StartCycles = FPlatformTime::Cycles64();
+
 	// Detect world change (PIE restart / map travel) and rebuild if needed
 	if (GetWorld() != CachedWorld)
 	{
@@ -53,79 +127,191 @@ AActor* UObjectPoolBase::AcquireActor()
 		PoolInstance->RefreshWorld(GetWorld());
 	}
 	AActor* Actor = PoolInstance ? PoolInstance->Acquire() : nullptr;
+
+	// Pool exhausted: auto-grow by doubling (add InitialSizeCached more). Time-sliced pools only spawn the
+	// one actor needed right now and leave the rest to the background predictor
+	if (!Actor)
+	{
+		INC_DWORD_STAT(STAT_PoolMissCount);
+		++Telemetry.Misses;
+		const int32 Additional = GrowthPolicy.bTimeSliced ? 1 : FMath::Max(1, InitialSizeCached);
+		if (GrowPool(Additional) && PoolInstance)
+		{
+			Actor = PoolInstance->Acquire();
+		}
+	}
+
 	if (Actor)
 	{
-		SyncGCProtection();
-		return Actor;
+		INC_DWORD_STAT(STAT_PoolActiveActors);
+		ActiveWatermark = FMath::Max(ActiveWatermark, PoolInstance->NumActive());
+		MinFreeSinceLastTrim = FMath::Min(MinFreeSinceLastTrim, PoolInstance->NumFree());
+		if (GrowthPolicy.bTimeSliced)
+		{
+			PredictGrowth();
+		}
 	}
 
-	// Pool exhausted: auto-grow by doubling (add InitialSizeCached more)
-	const int32 Additional = FMath::Max(1, InitialSizeCached);
-	if (GrowPool(Additional) && PoolInstance)
+	++Telemetry.Acquires;
+	Telemetry.Hits = Telemetry.Acquires - Telemetry.Misses;
+	Telemetry.PeakActive = FMath::Max(Telemetry.PeakActive, GetNumActive());
+	Telemetry.RecordAcquireLatency(FPlatformTime::ToMilliseconds64(FPlatformTime::Cycles64() - StartCycles) * 1000.0);
+	return Actor;
+}
+
+void UObjectPoolBase::PredictGrowth()
+{
+	if (PendingSpawns > 0 || !PoolInstance) return;
+
+	const int32 Capacity = PoolInstance->Num();
+	if (PoolInstance->NumFree() >= FMath::CeilToInt(Capacity * GrowthPolicy.LowFreeFraction)) return;
+
+	// Aim for the high watermark plus headroom, but never trickle in smaller steps than MinGrowthStep
+	const int32 Target = FMath::CeilToInt(ActiveWatermark * GrowthPolicy.HighWatermarkHeadroom);
+	PendingSpawns = FMath::Max(GrowthPolicy.MinGrowthStep, Target - Capacity);
+
+	// Don't grow into actors the trim policy would destroy again on its next pass
+	PendingSpawns = FMath::Max(0, FMath::Min(PendingSpawns, GetMaxActorsForBudget() - Capacity));
+	InitialSizeCached += PendingSpawns;
+}
+
+void UObjectPoolBase::TickTrim(float DeltaTime)
+{
+	if (!TrimPolicy.bEnabled || !PoolInstance) return;
+
+	TrimTimer += DeltaTime;
+	if (TrimTimer < TrimPolicy.TrimIntervalSeconds) return;
+	TrimTimer = 0.f;
+
+	int32 ToTrim = 0;
+
+	// Idle decay: actors that stayed free for the whole interval were not needed. Skip while still warming up
+	if (PendingSpawns == 0)
 	{
-		Actor = PoolInstance->Acquire();
-		if (Actor)
+		// Low point of the free count this interval; with no acquires at all every free actor sat idle
+		const int32 IdleFree = MinFreeSinceLastTrim == MAX_int32 ? PoolInstance->NumFree() : MinFreeSinceLastTrim;
+		const int32 Floor = TrimPolicy.bKeepInitialSize ? BaseSize : 0;
+		const int32 IdleSurplus = FMath::Min(IdleFree, PoolInstance->Num() - Floor);
+		if (IdleSurplus > 0)
 		{
-			SyncGCProtection();
-			return Actor;
+			ToTrim = FMath::CeilToInt(IdleSurplus * TrimPolicy.DecayFraction);
+
+			// Let the predictor forget the spike at the same rate, or it would grow straight back
+			ActiveWatermark = FMath::Max(PoolInstance->NumActive(), FMath::FloorToInt(ActiveWatermark * (1.f - TrimPolicy.DecayFraction)));
 		}
 	}
 
-	return nullptr;
+	// Memory budget overrides the floor
+	ToTrim = FMath::Max(ToTrim, PoolInstance->Num() - GetMaxActorsForBudget());
+
+	TrimFreeActors(ToTrim);
+	MinFreeSinceLastTrim = MAX_int32;
 }
 
-bool UObjectPoolBase::GrowPool(int32 AdditionalCount)
+int32 UObjectPoolBase::TrimForFloorTransition()
 {
-	if (!PoolInstance || !PooledClass || !CachedWorld.IsValid() || AdditionalCount <= 0)
+	if (!PoolInstance) return 0;
+
+	const int32 Trimmed = TrimFreeActors(PoolInstance->Num() - BaseSize);
+
+	// The last floor's spike says nothing about the next one
+	ActiveWatermark = PoolInstance->NumActive();
+	PendingSpawns = GrowthPolicy.bTimeSliced ? FMath::Max(0, BaseSize - PoolInstance->Num()) : 0;
+	MinFreeSinceLastTrim = MAX_int32;
+	TrimTimer = 0.f;
+	return Trimmed;
+}
+
+int32 UObjectPoolBase::TrimFreeActors(int32 Count)
+{
+	if (!PoolInstance || Count <= 0) return 0;
+
+	const int32 Trimmed = PoolInstance->TrimFree(Count);
+	InitialSizeCached = FMath::Max(BaseSize, PoolInstance->Num() + PendingSpawns);
+	Telemetry.ActorsTrimmed += Trimmed;
+	return Trimmed;
+}
+
+bool UObjectPoolBase::TickWarmUp(double DeadlineSeconds)
+{
+	if (!PoolInstance || !CachedWorld.IsValid())
 	{
+		PendingSpawns = 0;
 		return false;
 	}
 
-	UWorld* World = CachedWorld.Get();
-	FActorSpawnParameters Params;
-	Params.SpawnCollisionHandlingOverride = ESpawnActorCollisionHandlingMethod::AlwaysSpawn;
+	SCOPE_CYCLE_COUNTER(STAT_PoolWarmUp);
 
-	int32 Spawned = 0;
-	for (int32 i = 0; i < AdditionalCount; ++i)
+	// Always spawn at least one so a tiny budget still makes progress
+	do
 	{
-		if (!World) break;
-		AActor* NewActor = World->SpawnActor<AActor>(PooledClass, FTransform::Identity, Params);
-		if (NewActor)
+		if (PoolInstance->Grow(1) == 0)
 		{
-			// Return the new actor into the pool's free list
-			PoolInstance->Release(NewActor);
-			++Spawned;
+			PendingSpawns = 0;
+			break;
 		}
+		--PendingSpawns;
+		++Telemetry.ActorsSpawned;
+	}
+	while (PendingSpawns > 0 && FPlatformTime::Seconds() < DeadlineSeconds);
+
+	return PendingSpawns > 0;
+}
+
+bool UObjectPoolBase::GrowPool(int32 AdditionalCount)
+{
+	if (!PoolInstance || !PooledClass || !CachedWorld.IsValid() || AdditionalCount <= 0)
+	{
+		return false;
 	}
 
+	SCOPE_CYCLE_COUNTER(STAT_PoolGrow);
+
+	// New actors go straight onto the free stack
+	const int32 Spawned = PoolInstance->Grow(AdditionalCount);
 	if (Spawned > 0)
 	{
+		++Telemetry.GrowthEvents;
+		Telemetry.ActorsSpawned += Spawned;
 		InitialSizeCached += Spawned;
-		SyncGCProtection();
 		return true;
 	}
 
 	return false;
 }
 
-void UObjectPoolBase::ReleaseActor(AActor* Actor)
+bool UObjectPoolBase::ReleaseActor(AActor* Actor)
 {
-	if (PoolInstance && Actor)
+	SCOPE_CYCLE_COUNTER(STAT_PoolRelease);
+	const bool bReleased = PoolInstance && Actor && PoolInstance->Release(Actor);
+	if (bReleased)
 	{
-		PoolInstance->Release(Actor);
+		DEC_DWORD_STAT(STAT_PoolActiveActors);
+		++Telemetry.Releases;
 	}
+	return bReleased;
 }
 
-void UObjectPoolBase::SyncGCProtection()
+bool UObjectPoolBase::ReleaseSlot(int32 Slot, AActor* Actor)
 {
-	if (!PoolInstance) return;
-	GCProtectedPool.Empty();
-	for (const TWeakObjectPtr<AActor>& WeakActor : PoolInstance->GetPool())
+	SCOPE_CYCLE_COUNTER(STAT_PoolRelease);
+	const bool bReleased = PoolInstance && Actor && PoolInstance->ReleaseSlot(Slot, Actor);
+	if (bReleased)
 	{
-		if (WeakActor.IsValid())
-		{
-			GCProtectedPool.Add(WeakActor.Get());
-		}
+		DEC_DWORD_STAT(STAT_PoolActiveActors);
+		++Telemetry.Releases;
+	}
+	return bReleased;
+}
+
+void UObjectPoolBase::AddReferencedObjects(UObject* InThis, FReferenceCollector& Collector)
+{
+	Super::AddReferencedObjects(InThis, Collector);
+
+	UObjectPoolBase* This = CastChecked<UObjectPoolBase>(InThis);
+	if (This->PoolInstance)
+	{
+		This->PoolInstance->AddReferencedObjects(Collector, This);
 	}
 }
 
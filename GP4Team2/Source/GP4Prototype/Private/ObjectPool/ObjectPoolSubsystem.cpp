@@ -2,98 +2,233 @@
 
 
 #include "ObjectPool/ObjectPoolSubsystem.h"
+#include "ObjectPool/ObjectPoolStats.h"
+#include "ObjectPool/PooledActorComponent.h"
 #include "Debug.h"
+#include "Engine/GameInstance.h"
+#include "Engine/World.h"
+#include "HAL/IConsoleManager.h"
+#include "Misc/DateTime.h"
+#include "Misc/FileHelper.h"
+#include "Misc/Paths.h"
 
-UObjectPoolBase* UObjectPoolSubsystem::GetOrCreatePool(TSubclassOf<AActor> ActorClass, int32 DefaultSize)
+static FAutoConsoleCommandWithWorld GPoolDumpTelemetryCommand(
+	TEXT("GP4.Pool.DumpTelemetry"),
+	TEXT("Writes per-pool telemetry (hit rate, growth, peak occupancy, acquire latency) as CSV to Saved/Profiling"),
+	FConsoleCommandWithWorldDelegate::CreateLambda([](UWorld* World)
+	{
+		UGameInstance* GI = World ? World->GetGameInstance() : nullptr;
+		if (UObjectPoolSubsystem* PoolSubsystem = GI ? GI->GetSubsystem<UObjectPoolSubsystem>() : nullptr)
+		{
+			PoolSubsystem->DumpTelemetryCsv();
+		}
+	}));
+
+FPoolHandle UObjectPoolSubsystem::GetOrCreatePool(TSubclassOf<AActor> ActorClass, int32 DefaultSize, const FPoolGrowthPolicy& Policy)
 {
 	if (!ActorClass)
 	{
 		Debug::Log(TEXT("[PoolSubsystem] GetOrCreatePool called with null ActorClass"), bDebugOnScreen, DebugDuration);
-		return nullptr;
+		return FPoolHandle();
 	}
 	
-	if (UObjectPoolBase* ExistingPool = Pools.FindRef(ActorClass))
+	if (const FPoolHandle* ExistingHandle = HandlesByClass.Find(ActorClass))
 	{
-		const FString ClassName = GetNameSafe(*ActorClass);
-		Debug::Log(FString::Printf(TEXT("[PoolSubsystem] Found existing pool for %s: %p"), *ClassName, ExistingPool), bDebugOnScreen, DebugDuration);
-		return ExistingPool;
+		if (bDebugOnScreen)
+		{
+			Debug::Log(FString::Printf(TEXT("[PoolSubsystem] Found existing pool for %s: handle %d"), *GetNameSafe(*ActorClass), ExistingHandle->Index), bDebugOnScreen, DebugDuration);
+		}
+		return *ExistingHandle;
 	}
 
 	// Create new pool and add it to the map BEFORE initialization to handle callbacks during init
-	const FString ClassName = GetNameSafe(*ActorClass);
-	Debug::Log(FString::Printf(TEXT("[PoolSubsystem] Creating new pool for %s with size %d"), *ClassName, DefaultSize), bDebugOnScreen, DebugDuration);
+	if (bDebugOnScreen)
+	{
+		Debug::Log(FString::Printf(TEXT("[PoolSubsystem] Creating new pool for %s with size %d"), *GetNameSafe(*ActorClass), DefaultSize), bDebugOnScreen, DebugDuration);
+	}
 
 	UObjectPoolBase* NewPool = NewObject<UObjectPoolBase>(this);
-	Pools.Add(ActorClass, NewPool); // pre-register to avoid "No pool found" during init-time callbacks
-	NewPool->InitializePool(ActorClass, DefaultSize);
+	const FPoolHandle Handle(PoolList.Add(NewPool));
+	HandlesByClass.Add(ActorClass, Handle); // pre-register to avoid "No pool found" during init-time callbacks
+	NewPool->InitializePoolWithPolicy(ActorClass, DefaultSize, Policy);
 
-	return NewPool;
+	return Handle;
 }
 
-void UObjectPoolSubsystem::RegisterPool(TSubclassOf<AActor> ActorClass, int32 InitialSize)
+FPoolHandle UObjectPoolSubsystem::RegisterPool(TSubclassOf<AActor> ActorClass, int32 InitialSize)
 {
-	const FString ClassName = GetNameSafe(*ActorClass);
-	Debug::Log(FString::Printf(TEXT("[PoolSubsystem] RegisterPool %s size=%d"), *ClassName, InitialSize), bDebugOnScreen, DebugDuration);
-	GetOrCreatePool(ActorClass, InitialSize);
+	if (bDebugOnScreen)
+	{
+		Debug::Log(FString::Printf(TEXT("[PoolSubsystem] RegisterPool %s size=%d"), *GetNameSafe(*ActorClass), InitialSize), bDebugOnScreen, DebugDuration);
+	}
+	return GetOrCreatePool(ActorClass, InitialSize);
 }
 
-AActor* UObjectPoolSubsystem::AcquireActor(TSubclassOf<AActor> ActorClass)
+FPoolHandle UObjectPoolSubsystem::RegisterPoolWithPolicy(TSubclassOf<AActor> ActorClass, int32 InitialSize, const FPoolGrowthPolicy& Policy)
 {
-	const FString ClassName = GetNameSafe(*ActorClass);
-	Debug::Log(FString::Printf(TEXT("[PoolSubsystem] AcquireActor %s"), *ClassName), bDebugOnScreen, DebugDuration);
-	if (UObjectPoolBase* Pool = GetOrCreatePool(ActorClass))
+	if (bDebugOnScreen)
 	{
-		AActor* Actor = Pool->AcquireActor();
-		Debug::Log(FString::Printf(TEXT("[PoolSubsystem] AcquireActor -> %p"), Actor), bDebugOnScreen, DebugDuration);
-		return Actor;
+		Debug::Log(FString::Printf(TEXT("[PoolSubsystem] RegisterPool %s size=%d timesliced=%d"), *GetNameSafe(*ActorClass), InitialSize, Policy.bTimeSliced ? 1 : 0), bDebugOnScreen, DebugDuration);
 	}
-	Debug::Log(TEXT("[PoolSubsystem] AcquireActor -> nullptr (no pool)"), bDebugOnScreen, DebugDuration);
-	return nullptr;
+	return GetOrCreatePool(ActorClass, InitialSize, Policy);
 }
 
-void UObjectPoolSubsystem::ReleaseActor(AActor* Actor)
+void UObjectPoolSubsystem::SetTrimPolicy(FPoolHandle Handle, const FPoolTrimPolicy& Policy)
 {
-	if (!Actor)
+	if (UObjectPoolBase* Pool = GetPool(Handle))
 	{
-		Debug::Log(TEXT("[PoolSubsystem] ReleaseActor called with null Actor"), bDebugOnScreen, DebugDuration);
-		return;
+		Pool->SetTrimPolicy(Policy);
 	}
+}
 
-	// Exact class match first
-	TSubclassOf<AActor> ActorClass = Actor->GetClass();
-	UObjectPoolBase* Pool = Pools.FindRef(ActorClass);
+int32 UObjectPoolSubsystem::TrimPoolsForFloorTransition()
+{
+	int32 Trimmed = 0;
+	for (const TObjectPtr<UObjectPoolBase>& Pool : PoolList)
+	{
+		if (Pool) Trimmed += Pool->TrimForFloorTransition();
+	}
+	Debug::Log(FString::Printf(TEXT("[PoolSubsystem] Floor transition trimmed %d pooled actors"), Trimmed), bDebugOnScreen, DebugDuration);
+	return Trimmed;
+}
 
-	// Fallback: scan for a pool whose pooled class matches or is related
-	if (!Pool)
+void UObjectPoolSubsystem::RecordFallbackSpawn(FPoolHandle Handle)
+{
+	INC_DWORD_STAT(STAT_PoolFallbackSpawnCount);
+	if (UObjectPoolBase* Pool = GetPool(Handle))
 	{
-		for (const auto& KVP : Pools)
+		Pool->RecordFallbackSpawn();
+	}
+}
+
+FPoolTelemetry UObjectPoolSubsystem::GetPoolTelemetry(FPoolHandle Handle) const
+{
+	const UObjectPoolBase* Pool = GetPool(Handle);
+	return Pool ? Pool->GetTelemetry() : FPoolTelemetry();
+}
+
+void UObjectPoolSubsystem::ResetTelemetry()
+{
+	for (const TObjectPtr<UObjectPoolBase>& Pool : PoolList)
+	{
+		if (Pool) Pool->ResetTelemetry();
+	}
+}
+
+FString UObjectPoolSubsystem::BuildTelemetryCsv() const
+{
+	FString Csv = TEXT("Handle,Class,Free,Active,PeakActive,Acquires,Hits,Misses,HitRate,Releases,GrowthEvents,ActorsSpawned,FallbackSpawns,ActorsTrimmed,AvgAcquireUs");
+	for (int32 Bucket = 0; Bucket < FPoolTelemetry::NumLatencyBuckets; ++Bucket)
+	{
+		// Last bucket is open ended
+		if (Bucket == FPoolTelemetry::NumLatencyBuckets - 1) Csv += FString::Printf(TEXT(",Lat_ge%dus"), 1 << (Bucket - 1));
+		else Csv += FString::Printf(TEXT(",Lat_lt%dus"), 1 << Bucket);
+	}
+	Csv += LINE_TERMINATOR;
+
+	for (int32 Index = 0; Index < PoolList.Num(); ++Index)
+	{
+		const UObjectPoolBase* Pool = PoolList[Index];
+		if (!Pool) continue;
+
+		const FPoolTelemetry& T = Pool->GetTelemetry();
+		Csv += FString::Printf(TEXT("%d,%s,%d,%d,%d,%d,%d,%d,%.4f,%d,%d,%d,%d,%d,%.3f"),
+			Index, *GetNameSafe(*Pool->GetPooledClass()), Pool->GetNumFree(), Pool->GetNumActive(), T.PeakActive,
+			T.Acquires, T.Hits, T.Misses, T.GetHitRate(), T.Releases, T.GrowthEvents, T.ActorsSpawned, T.FallbackSpawns,
+			T.ActorsTrimmed, T.GetAverageAcquireMicroseconds());
+		for (const int32 Count : T.AcquireLatencyBuckets)
 		{
-			if (!KVP.Value) continue;
-			UClass* PooledClass = *KVP.Value->GetPooledClass();
-			if (!PooledClass) continue;
-
-			// Match exact or inheritance to be resilient against hot-reload/PIE edge cases
-			if (ActorClass == PooledClass || ActorClass->IsChildOf(PooledClass) || PooledClass->IsChildOf(ActorClass))
-			{
-				Pool = KVP.Value;
-				break;
-			}
+			Csv += FString::Printf(TEXT(",%d"), Count);
 		}
+		Csv += LINE_TERMINATOR;
 	}
+	return Csv;
+}
 
-	const FString ActorName = GetNameSafe(Actor);
-	const FString ActorClassName = GetNameSafe(ActorClass);
-
-	if (Pool)
+bool UObjectPoolSubsystem::DumpTelemetryCsv()
+{
+	const FString Path = FPaths::ProfilingDir() / FString::Printf(TEXT("PoolTelemetry-%s.csv"), *FDateTime::Now().ToString());
+	const bool bSaved = FFileHelper::SaveStringToFile(BuildTelemetryCsv(), *Path);
+	if (bSaved)
 	{
-		const FString PooledClassName = Pool->GetPooledClass() ? GetNameSafe(*Pool->GetPooledClass()) : FString(TEXT("<null>"));
-		Debug::Log(FString::Printf(TEXT("[PoolSubsystem] Releasing %s (%p) to pool %p (PooledClass=%s)"),
-			*ActorName, Actor, Pool, *PooledClassName), bDebugOnScreen, DebugDuration);
-		Pool->ReleaseActor(Actor);
+		Debug::Log(FString::Printf(TEXT("[PoolSubsystem] Telemetry written to %s"), *Path), bDebugOnScreen, DebugDuration);
 	}
 	else
 	{
-		Debug::Log(FString::Printf(TEXT("[PoolSubsystem] No pool found for actor %s (%p) Class=%s; ignoring"),
-			*ActorName, Actor, *ActorClassName), bDebugOnScreen, DebugDuration);
+		Debug::LogWarning(FString::Printf(TEXT("[PoolSubsystem] Failed to write telemetry to %s"), *Path), bDebugOnScreen, DebugDuration);
 	}
-}
\ No newline at end of file
+	return bSaved;
+}
+
+bool UObjectPoolSubsystem::IsTickable() const
+{
+	for (const TObjectPtr<UObjectPoolBase>& Pool : PoolList)
+	{
+		if (Pool && (Pool->HasPendingWarmUp() || Pool->IsTrimEnabled())) return true;
+	}
+	return false;
+}
+
+void UObjectPoolSubsystem::Tick(float DeltaTime)
+{
+	for (const TObjectPtr<UObjectPoolBase>& Pool : PoolList)
+	{
+		if (Pool) Pool->TickTrim(DeltaTime);
+	}
+
+	// One shared deadline: pools are served in registration order until the frame budget is spent
+	const double Deadline = FPlatformTime::Seconds() + WarmUpBudgetMs / 1000.0;
+	for (const TObjectPtr<UObjectPoolBase>& Pool : PoolList)
+	{
+		if (!Pool || !Pool->HasPendingWarmUp()) continue;
+
+		Pool->TickWarmUp(Deadline);
+		if (FPlatformTime::Seconds() >= Deadline) break;
+	}
+}
+
+AActor* UObjectPoolSubsystem::AcquireActorByHandle(FPoolHandle Handle)
+{
+	UObjectPoolBase* Pool = GetPool(Handle);
+	return Pool ? Pool->AcquireActor() : nullptr;
+}
+
+AActor* UObjectPoolSubsystem::AcquireActor(TSubclassOf<AActor> ActorClass)
+{
+	AActor* Actor = AcquireActorByHandle(GetOrCreatePool(ActorClass));
+	if (bDebugOnScreen)
+	{
+		Debug::Log(FString::Printf(TEXT("[PoolSubsystem] AcquireActor %s -> %p"), *GetNameSafe(*ActorClass), Actor), bDebugOnScreen, DebugDuration);
+	}
+	return Actor;
+}
+
+bool UObjectPoolSubsystem::ReleaseActor(AActor* Actor)
+{
+	if (!Actor)
+	{
+		Debug::Log(TEXT("[PoolSubsystem] ReleaseActor called with null Actor"), bDebugOnScreen, DebugDuration);
+		return false;
+	}
+
+	// Native poolables hand over their cached back-reference; anything else goes through its class's pool, which
+	// finds the slot in its lookup map
+	bool bReleased = false;
+	const IPoolable* Poolable = Cast<IPoolable>(Actor);
+	if (UPooledActorComponent* PooledComp = Poolable ? Poolable->GetPooledComponent() : nullptr)
+	{
+		bReleased = PooledComp->ReleaseToPool();
+	}
+	else if (const FPoolHandle* Handle = HandlesByClass.Find(Actor->GetClass()))
+	{
+		UObjectPoolBase* Pool = GetPool(*Handle);
+		bReleased = Pool && Pool->ReleaseActor(Actor);
+	}
+
+	if (bDebugOnScreen)
+	{
+		Debug::Log(FString::Printf(TEXT("[PoolSubsystem] Release %s (%p) -> %s"),
+			*GetNameSafe(Actor), Actor, bReleased ? TEXT("pooled") : TEXT("not pooled; ignoring")), bDebugOnScreen, DebugDuration);
+	}
+	return bReleased;
+}
@@ -2,10 +2,12 @@
 #pragma once
 
 #include "Debug.h"
+#include "Components/ActorComponent.h"
+#include "GameFramework/Actor.h"
 
 template <typename T>
-TObjectPool<T>::TObjectPool(UWorld* InWorld, TSubclassOf<T> InClass, int32 InInitialSize, UObject* /*Owner*/)
-	: WorldPtr(InWorld), ClassToSpawn(InClass)
+TObjectPool<T>::TObjectPool(UWorld* InWorld, TSubclassOf<T> InClass, int32 InInitialSize, UObject* /*Owner*/, FOnSpawned InOnSpawned)
+	: WorldPtr(InWorld), ClassToSpawn(InClass), OnSpawned(MoveTemp(InOnSpawned))
 {
 	if (!WorldPtr.IsValid() || !ClassToSpawn)
 	{
@@ -13,99 +15,288 @@ TObjectPool<T>::TObjectPool(UWorld* InWorld, TSubclassOf<T> InClass, int32 InIni
 		return;
 	}
 
+	static_assert(TIsDerivedFrom<T, AActor>::Value, "World/class TObjectPool constructor is for actors, use the factory constructor");
+
+	bPoolable = ClassToSpawn->ImplementsInterface(UPoolable::StaticClass());
+	bPoolableResolved = true;
+
 	// Debug::Log(FString::Printf(TEXT("[Pool] Creating pool for %s (size=%d) World=%s"), *GetNameSafe(*ClassToSpawn), InInitialSize, *GetNameSafe(WorldPtr.Get())), true, 5.f);
 
-	for (int32 i = 0; i < InInitialSize; ++i)
+	Items.Reserve(InInitialSize);
+	ItemKeys.Reserve(InInitialSize);
+	ActivePosition.Reserve(InInitialSize);
+	FreeSlots.Reserve(InInitialSize);
+	ActiveSlots.Reserve(InInitialSize);
+	SlotLookup.Reserve(InInitialSize);
+	Grow(InInitialSize);
+}
+
+template <typename T>
+TObjectPool<T>::TObjectPool(FFactory InFactory, FResetFn InReset, int32 InInitialSize, FOnSpawned InOnSpawned)
+	: OnSpawned(MoveTemp(InOnSpawned)), Factory(MoveTemp(InFactory)), ResetFn(MoveTemp(InReset))
+{
+	if (!Factory)
 	{
-		if (T* Spawned = SpawnNew())
-		{
-			Pool.Add(Spawned);
-		}
+		Debug::LogWarning(TEXT("[Pool] No factory passed to TObjectPool (constructor)"), true, 5.f);
+		return;
 	}
+
+	Items.Reserve(InInitialSize);
+	ItemKeys.Reserve(InInitialSize);
+	ActivePosition.Reserve(InInitialSize);
+	FreeSlots.Reserve(InInitialSize);
+	ActiveSlots.Reserve(InInitialSize);
+	SlotLookup.Reserve(InInitialSize);
+	Grow(InInitialSize);
 }
 
 template <typename T>
 T* TObjectPool<T>::Acquire()
 {
-	// Cull invalid
-	for (int32 i = 0; i < Pool.Num(); )
+	while (FreeSlots.Num() > 0)
 	{
-		TWeakObjectPtr<T>& Entry = Pool[i];
-		if (!Entry.IsValid())
+		const int32 Slot = FreeSlots.Pop(EAllowShrinking::No);
+		T* Obj = Items[Slot];
+
+		// Destroyed behind our back (level teardown, manual Destroy): drop the slot and keep looking
+		if (!IsValid(Obj))
 		{
-			Pool.RemoveAtSwap(i);
+			DiscardSlot(Slot);
 			continue;
 		}
 
-		T* Obj = Entry.Get();
-		if (!IsValid(Obj))
+		ActivePosition[Slot] = ActiveSlots.Add(Slot);
+		Activate(Obj);
+		return Obj;
+	}
+
+	return nullptr;
+}
+
+template <typename T>
+bool TObjectPool<T>::Release(T* Obj)
+{
+	if (!IsValid(Obj)) return false;
+
+	const int32* SlotPtr = SlotLookup.Find(TObjectKey<T>(Obj));
+	if (!SlotPtr) return false;
+
+	return ReleaseSlot(*SlotPtr, Obj);
+}
+
+template <typename T>
+bool TObjectPool<T>::ReleaseSlot(int32 Slot, T* Obj)
+{
+	if (!Items.IsValidIndex(Slot) || Items[Slot] != Obj || !IsValid(Obj)) return false;
+
+	const int32 Position = ActivePosition[Slot];
+	if (Position == INDEX_NONE)
+	{
+		// Already free: report it so callers do not count the release twice
+		return false;
+	}
+
+	// Swap-remove from the active stack and patch the moved slot's position
+	const int32 LastSlot = ActiveSlots.Last();
+	ActiveSlots[Position] = LastSlot;
+	ActivePosition[LastSlot] = Position;
+	ActiveSlots.Pop(EAllowShrinking::No);
+
+	ActivePosition[Slot] = INDEX_NONE;
+	FreeSlots.Push(Slot);
+	Deactivate(Obj);
+	return true;
+}
+
+template <typename T>
+int32 TObjectPool<T>::Grow(int32 AdditionalCount)
+{
+	CullDestroyedActive();
+
+	int32 Spawned = 0;
+	for (int32 i = 0; i < AdditionalCount; ++i)
+	{
+		T* Obj = SpawnNew();
+		if (!Obj) break;
+
+		const int32 Slot = AddToSlot(Obj);
+		if (OnSpawned)
 		{
-			Pool.RemoveAtSwap(i);
-			continue;
+			OnSpawned(Obj, Slot);
 		}
+		FreeSlots.Push(Slot);
+		++Spawned;
+	}
+	return Spawned;
+}
+
+template <typename T>
+int32 TObjectPool<T>::TrimFree(int32 Count)
+{
+	int32 Trimmed = 0;
+	while (Trimmed < Count && FreeSlots.Num() > 0)
+	{
+		const int32 Slot = FreeSlots.Pop(EAllowShrinking::No);
+		T* Obj = Items[Slot];
+		DiscardSlot(Slot);
 
-		// Free slot is one that is currently deactivated (tick disabled)
-		if (!Obj->IsActorTickEnabled())
+		if (IsValid(Obj))
 		{
-			Obj->SetActorHiddenInGame(false);
-			Obj->SetActorEnableCollision(true);
-			Obj->SetActorTickEnabled(true);
-			return Obj;
+			if constexpr (TIsDerivedFrom<T, AActor>::Value)
+			{
+				Obj->Destroy();
+			}
+			else if (UActorComponent* Component = Cast<UActorComponent>(Obj))
+			{
+				Component->DestroyComponent();
+			}
+			// Anything else is collected once the slot no longer references it
+			++Trimmed;
 		}
-		++i;
 	}
+	return Trimmed;
+}
+
+template <typename T>
+void TObjectPool<T>::AddReferencedObjects(FReferenceCollector& Collector, const UObject* ReferencingObject)
+{
+	Collector.AddReferencedObjects(Items, ReferencingObject);
+}
 
-	// Need a new instance
-	T* NewObj = SpawnNew();
-	if (IsValid(NewObj))
+template <typename T>
+int32 TObjectPool<T>::AddToSlot(T* Obj)
+{
+	int32 Slot;
+	if (DeadSlots.Num() > 0)
 	{
-		Pool.Add(NewObj);
-		NewObj->SetActorHiddenInGame(false);
-		NewObj->SetActorEnableCollision(true);
-		NewObj->SetActorTickEnabled(true);
+		Slot = DeadSlots.Pop(EAllowShrinking::No);
+		Items[Slot] = Obj;
+		ItemKeys[Slot] = TObjectKey<T>(Obj);
+		ActivePosition[Slot] = INDEX_NONE;
 	}
 	else
 	{
-		Debug::LogWarning(FString::Printf(TEXT("[Pool] SpawnNew failed for class %s (World valid=%d)"), *GetNameSafe(*ClassToSpawn), WorldPtr.IsValid() ? 1 : 0), true, 5.f);
+		Slot = Items.Add(Obj);
+		ItemKeys.Add(TObjectKey<T>(Obj));
+		ActivePosition.Add(INDEX_NONE);
 	}
-	return NewObj;
+	SlotLookup.Add(TObjectKey<T>(Obj), Slot);
+	return Slot;
 }
 
 template <typename T>
-void TObjectPool<T>::Release(T* Obj)
+void TObjectPool<T>::DiscardSlot(int32 Slot)
 {
-	if (!IsValid(Obj)) return;
-	Obj->SetActorHiddenInGame(true);
-	Obj->SetActorEnableCollision(false);
-	Obj->SetActorTickEnabled(false);
+	SlotLookup.Remove(ItemKeys[Slot]);
+	Items[Slot] = nullptr;
+	ItemKeys[Slot] = TObjectKey<T>();
+	ActivePosition[Slot] = INDEX_NONE;
+	DeadSlots.Push(Slot);
 }
 
 template <typename T>
-T* TObjectPool<T>::SpawnNew()
+void TObjectPool<T>::CullDestroyedActive()
 {
-	UWorld* World = WorldPtr.Get();
-	if (!World)
+	// Active actors destroyed instead of released would otherwise hold their slot forever
+	for (int32 Position = ActiveSlots.Num() - 1; Position >= 0; --Position)
 	{
-		Debug::LogWarning(TEXT("[Pool] SpawnNew aborted: World is null (possibly map travel)"), true, 5.f);
-		return nullptr;
+		const int32 Slot = ActiveSlots[Position];
+		if (IsValid(Items[Slot])) continue;
+
+		const int32 LastSlot = ActiveSlots.Last();
+		ActiveSlots[Position] = LastSlot;
+		ActivePosition[LastSlot] = Position;
+		ActiveSlots.Pop(EAllowShrinking::No);
+		DiscardSlot(Slot);
+	}
+}
+
+template <typename T>
+void TObjectPool<T>::Activate(T* Obj) const
+{
+	if (ResetFn)
+	{
+		ResetFn(Obj, true);
 	}
-	if (!IsValid(ClassToSpawn))
+	else if constexpr (TIsDerivedFrom<T, AActor>::Value)
 	{
-		Debug::LogWarning(TEXT("[Pool] SpawnNew aborted: ClassToSpawn invalid"), true, 5.f);
-		return nullptr;
+		PooledActorState::SetActive(Obj, true);
+	}
+	if (bPoolable)
+	{
+		IPoolable::Execute_OnAcquired(Obj);
+	}
+}
+
+template <typename T>
+void TObjectPool<T>::Deactivate(T* Obj) const
+{
+	if (bPoolable)
+	{
+		IPoolable::Execute_OnReleased(Obj);
+	}
+	if (ResetFn)
+	{
+		ResetFn(Obj, false);
+	}
+	else if constexpr (TIsDerivedFrom<T, AActor>::Value)
+	{
+		PooledActorState::SetActive(Obj, false);
 	}
+}
+
+template <typename T>
+T* TObjectPool<T>::SpawnNew()
+{
+	if (Factory)
+	{
+		T* Created = Factory();
+		if (!IsValid(Created))
+		{
+			Debug::Log(TEXT("[Pool] Factory returned invalid object"), true, 5.f);
+			return nullptr;
+		}
+
+		if (!bPoolableResolved)
+		{
+			bPoolable = Created->GetClass()->ImplementsInterface(UPoolable::StaticClass());
+			bPoolableResolved = true;
+		}
 
-	FActorSpawnParameters Params;
-	Params.SpawnCollisionHandlingOverride = ESpawnActorCollisionHandlingMethod::AlwaysSpawn;
-	T* Obj = World->SpawnActor<T>(ClassToSpawn, FTransform::Identity, Params);
+		Deactivate(Created);
+		return Created;
+	}
 
-	if (!IsValid(Obj))
+	if constexpr (!TIsDerivedFrom<T, AActor>::Value)
 	{
-		Debug::Log(TEXT("[Pool] SpawnActor returned invalid object"), true, 5.f);
 		return nullptr;
 	}
+	else
+	{
+		UWorld* World = WorldPtr.Get();
+		if (!World)
+		{
+			Debug::LogWarning(TEXT("[Pool] SpawnNew aborted: World is null (possibly map travel)"), true, 5.f);
+			return nullptr;
+		}
+		if (!IsValid(ClassToSpawn))
+		{
+			Debug::LogWarning(TEXT("[Pool] SpawnNew aborted: ClassToSpawn invalid"), true, 5.f);
+			return nullptr;
+		}
 
-	// Put into inactive state immediately
-	Release(Obj);
-	return Obj;
+		FActorSpawnParameters Params;
+		Params.SpawnCollisionHandlingOverride = ESpawnActorCollisionHandlingMethod::AlwaysSpawn;
+		T* Obj = World->SpawnActor<T>(ClassToSpawn, FTransform::Identity, Params);
+
+		if (!IsValid(Obj))
+		{
+			Debug::Log(TEXT("[Pool] SpawnActor returned invalid object"), true, 5.f);
+			return nullptr;
+		}
+
+		// Put into inactive state immediately
+		Deactivate(Obj);
+		return Obj;
+	}
 }
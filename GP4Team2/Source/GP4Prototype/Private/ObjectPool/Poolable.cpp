@@ -0,0 +1,43 @@
+#include "ObjectPool/Poolable.h"
+
+#include "Components/PrimitiveComponent.h"
+#include "GameFramework/Actor.h"
+#include "GameFramework/MovementComponent.h"
+
+
+void PooledActorState::SetActive(AActor* Actor, bool bActive)
+{
+	if (!IsValid(Actor)) return;
+
+	Actor->SetActorHiddenInGame(!bActive);
+	Actor->SetActorEnableCollision(bActive);
+	Actor->SetActorTickEnabled(bActive && Actor->PrimaryActorTick.bStartWithTickEnabled);
+
+	for (UActorComponent* Component : Actor->GetComponents())
+	{
+		if (!Component) continue;
+
+		Component->SetComponentTickEnabled(bActive && Component->PrimaryComponentTick.bStartWithTickEnabled);
+
+		if (UMovementComponent* Movement = Cast<UMovementComponent>(Component))
+		{
+			// A sleeping projectile must not resume with last use's velocity
+			Movement->StopMovementImmediately();
+		}
+		else if (UPrimitiveComponent* Primitive = Cast<UPrimitiveComponent>(Component))
+		{
+			if (!bActive && Primitive->IsSimulatingPhysics())
+			{
+				Primitive->SetSimulatePhysics(false);
+			}
+			else if (bActive)
+			{
+				const UPrimitiveComponent* Archetype = Cast<UPrimitiveComponent>(Primitive->GetArchetype());
+				if (Archetype && Archetype->BodyInstance.bSimulatePhysics)
+				{
+					Primitive->SetSimulatePhysics(true);
+				}
+			}
+		}
+	}
+}
@@ -0,0 +1,24 @@
+﻿// Fill out your copyright notice in the Description page of Project Settings.
+
+
+#include "ObjectPool/PooledActorComponent.h"
+
+#include "ObjectPool/ObjectPoolBase.h"
+
+
+UPooledActorComponent::UPooledActorComponent()
+{
+	PrimaryComponentTick.bCanEverTick = false;
+}
+
+void UPooledActorComponent::Bind(UObjectPoolBase* InPool, int32 InSlot)
+{
+	OwningPool = InPool;
+	Slot = InSlot;
+}
+
+bool UPooledActorComponent::ReleaseToPool()
+{
+	UObjectPoolBase* Pool = OwningPool.Get();
+	return Pool && Pool->ReleaseSlot(Slot, GetOwner());
+}
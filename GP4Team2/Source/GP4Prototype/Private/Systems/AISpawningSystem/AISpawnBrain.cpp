@@ -5,6 +5,7 @@
 #include "Character/AICharacterBase.h"
 #include "Kismet/GameplayStatics.h"
 #include "Systems/AISpawningSystem/AISpawnTrigger.h"
+#include "Systems/AISpawningSystem/EnemyBroadphaseSubsystem.h"
 
 
 // Sets default values
@@ -20,6 +21,10 @@ AAISpawnBrain::AAISpawnBrain()
 void AAISpawnBrain::BeginPlay()
 {
 	Super::BeginPlay();
+
+	EnemyBroadphase = GetWorld()->GetSubsystem<UEnemyBroadphaseSubsystem>();
+	if (EnemyBroadphase) EnemyBroadphase->ActivateGrid(EnemyGridCellSize);
+
 	CollectAllAICharacters();
 	CollectTriggers();
 
@@ -29,6 +34,13 @@ void AAISpawnBrain::BeginPlay()
 void AAISpawnBrain::Tick(float DeltaTime)
 {
 	Super::Tick(DeltaTime);
+
+	// enemies move every frame and props get knocked around; keep the combat grid in step
+	if (EnemyBroadphase)
+	{
+		EnemyBroadphase->UpdateEnemies(ActiveEnemies);
+		EnemyBroadphase->UpdateDamageables();
+	}
 }
 
 void AAISpawnBrain::CollectAllAICharacters()
@@ -46,7 +58,7 @@ void AAISpawnBrain::CollectAllAICharacters()
 		if (AAICharacterBase* AICharacter = Cast<AAICharacterBase>(Actor))
 		{
 			CollectedAICharacters.Add(AICharacter);
-			ActiveEnemies.AddUnique(AICharacter);
+			RegisterActiveEnemy(AICharacter);
 			AICharacter->SpawnBrain = this;
 		}
 	}
@@ -104,9 +116,18 @@ void AAISpawnBrain::CalculateTotalAI()
 	TotalEnemiesForFloor += CollectedAICharacters.Num();
 }
 
+void AAISpawnBrain::RegisterActiveEnemy(AAICharacterBase* Enemy)
+{
+	if (!Enemy) return;
+
+	ActiveEnemies.AddUnique(Enemy);
+	if (EnemyBroadphase) EnemyBroadphase->AddEnemy(Enemy);
+}
+
 void AAISpawnBrain::HandleAIDeath(AAICharacterBase* DeadAI)
 {
 	if (!DeadAI) return;
+	if (EnemyBroadphase) EnemyBroadphase->RemoveEnemy(DeadAI);
 	if (ActiveEnemies.Contains(DeadAI))
 	{
 		ActiveEnemies.Remove(DeadAI);
@@ -12,6 +12,11 @@ AAISpawnPoint::AAISpawnPoint()
 {
 	// Set this actor to call Tick() every frame.  You can turn this off to improve performance if you don't need it.
 	PrimaryActorTick.bCanEverTick = true;
+
+#if WITH_EDITORONLY_DATA
+	// OnConstruction samples the navmesh; run it once on drop rather than on every drag step
+	bRunConstructionScriptOnDrag = false;
+#endif
 }
 
 void AAISpawnPoint::OnConstruction(const FTransform& Transform)
@@ -38,48 +43,154 @@ void AAISpawnPoint::OnConstruction(const FTransform& Transform)
 			}
 		}
 	}
-	#if WITH_EDITOR
+#if WITH_EDITOR
+	// game worlds sample in BeginPlay instead
+	if (!GetWorld() || GetWorld()->IsGameWorld()) return;
+
     FlushPersistentDebugLines(GetWorld()); // clear previous draws
 
-    UNavigationSystemV1* NavSys = FNavigationSystem::GetCurrent<UNavigationSystemV1>(GetWorld());
-    if (!NavSys) return;
+	// bake the pool with the level so spawning never queries nav or traces; skip it when nothing it depends on moved
+	if (RelativeSpawnLocationPool.IsEmpty() || SpawnPoolBuildKey != ComputeSpawnPoolBuildKey())
+	{
+		BuildSpawnLocationPool();
+	}
+
+	const FTransform PoolFrame = GetSpawnPoolFrame();
+	for (const FVector& RelativeLocation : RelativeSpawnLocationPool)
+	{
+		DrawDebugBox(
+			GetWorld(),
+			PoolFrame.TransformPosition(RelativeLocation),
+			FVector(10.f),       // half size of the debug cube
+			FColor::Cyan,
+			true                 // persistent until next FlushPersistentDebugLines
+		);
+	}
+#endif
+}
+
+void AAISpawnPoint::BuildSpawnLocationPool()
+{
+	RelativeSpawnLocationPool.Reset();
+	NextSpawnPoolIndex = 0;
+
+	UWorld* World = GetWorld();
+	if (!World) return;
+
+	++SpawnPoolBuildCount;
+	SpawnPoolBuildKey = ComputeSpawnPoolBuildKey();
+	NextSpawnPoolRetryTime = World->GetTimeSeconds() + SpawnPoolRetryInterval;
+
+	UNavigationSystemV1* NavSys = FNavigationSystem::GetCurrent<UNavigationSystemV1>(World);
+	if (!NavSys)
+	{
+		UE_LOG(LogTemp, Warning, TEXT("%s: spawn location pool is empty, no navigation system in the world."), *GetName());
+		return;
+	}
+
+	const float Step = FMath::Max(SpawnPoolGridStep, 10.f);
+	const FVector Origin = GetActorLocation();
+	const FTransform PoolFrame = GetSpawnPoolFrame();
+
+	// split the box's height into layers so a box spanning several floors samples each of them
+	const float HalfHeight = FMath::Max(SpawnSearchRadius.Z, 1.f);
+	const int32 NumLayers = FMath::Max(1, FMath::CeilToInt(2.f * HalfHeight / FMath::Max(SpawnPoolLayerHeight, 10.f)));
+	const float LayerHeight = 2.f * HalfHeight / NumLayers;
 
-    const float Step = 100.f;
-    FVector Origin = GetActorLocation();
+	FCollisionQueryParams QueryParams(SCENE_QUERY_STAT(AISpawnPoolGround), true); // complex, to land on the visible floor
+	QueryParams.AddIgnoredActor(this);
 
-	for (float x = -SpawnSearchRadius.X; x <= SpawnSearchRadius.X; x += Step)
+	// neighbouring layers can project onto the same navmesh point
+	TSet<FIntVector> Seen;
+
+	for (int32 Layer = 0; Layer < NumLayers; ++Layer)
 	{
-		for (float y = -SpawnSearchRadius.Y; y <= SpawnSearchRadius.Y; y += Step)
+		const float z = -HalfHeight + LayerHeight * (Layer + 0.5f);
+		for (float x = -SpawnSearchRadius.X; x <= SpawnSearchRadius.X; x += Step)
 		{
-			// You can also add a Z loop if you want a 3D volume
-			FVector TestPoint = Origin + FVector(x, y, 0.f);
-
-			FNavLocation NavLoc;
-			// Project the point onto the navmesh
-			if (NavSys->ProjectPointToNavigation(
-					TestPoint,
-					NavLoc,
-					FVector(50.f, 50.f, SpawnSearchRadius.Z) // search extent (Z controls how high/low we project)
-				))
+			for (float y = -SpawnSearchRadius.Y; y <= SpawnSearchRadius.Y; y += Step)
 			{
-				DrawDebugBox(
-					GetWorld(),
-					NavLoc.Location,
-					FVector(10.f),       // half size of the debug cube
-					FColor::Cyan,
-					true                 // persistent until next FlushPersistentDebugLines
-				);
+				FVector TestPoint = Origin + FVector(x, y, z);
+
+				FNavLocation NavLoc;
+				// Project the point onto the navmesh
+				if (!NavSys->ProjectPointToNavigation(
+						TestPoint,
+						NavLoc,
+						FVector(Step * 0.5f, Step * 0.5f, LayerHeight * 0.5f) // search extent; Z stays inside this layer
+					)) continue;
+
+				bool bAlreadySeen = false;
+				Seen.Add(FIntVector(NavLoc.Location / 10.f), &bAlreadySeen);
+				if (bAlreadySeen) continue;
+
+				// snap to the floor under the navmesh point (the navmesh floats a little above it); short trace so it
+				// cannot land on the floor above or below
+				FVector GroundLocation = NavLoc.Location;
+				FHitResult HitResult;
+				if (World->LineTraceSingleByChannel(
+						HitResult,
+						NavLoc.Location + FVector(0.f, 0.f, 50.f),
+						NavLoc.Location - FVector(0.f, 0.f, 100.f),
+						ECC_WorldStatic,
+						QueryParams
+					))
+				{
+					GroundLocation = HitResult.ImpactPoint;
+				}
+
+				RelativeSpawnLocationPool.Add(PoolFrame.InverseTransformPosition(GroundLocation));
 			}
 		}
 	}
-#endif
+
+	if (RelativeSpawnLocationPool.IsEmpty())
+	{
+		UE_LOG(LogTemp, Warning, TEXT("%s: spawn location pool is empty, no navmesh inside the search box."), *GetName());
+	}
+}
+
+uint32 AAISpawnPoint::ComputeSpawnPoolBuildKey() const
+{
+	uint32 Key = GetTypeHash(GetActorLocation());
+	Key = HashCombine(Key, GetTypeHash(GetActorQuat().Euler()));
+	Key = HashCombine(Key, GetTypeHash(SpawnSearchRadius));
+	Key = HashCombine(Key, GetTypeHash(SpawnPoolGridStep));
+	return HashCombine(Key, GetTypeHash(SpawnPoolLayerHeight));
+}
+
+bool AAISpawnPoint::DrawSpawnLocation(FVector& OutLocation)
+{
+	// navmesh may only exist at runtime (dynamic generation); re-sample once it does, but at most every
+	// SpawnPoolRetryInterval so a spawner without nav does not pay for the full grid on every attempt
+	if (RelativeSpawnLocationPool.IsEmpty())
+	{
+		const UWorld* World = GetWorld();
+		if (!World || World->GetTimeSeconds() < NextSpawnPoolRetryTime) return false;
+		BuildSpawnLocationPool();
+	}
+	if (RelativeSpawnLocationPool.IsEmpty()) return false;
+
+	// shuffle bag: every location is used once before any repeats
+	if (NextSpawnPoolIndex >= RelativeSpawnLocationPool.Num() || NextSpawnPoolIndex == 0)
+	{
+		for (int32 i = RelativeSpawnLocationPool.Num() - 1; i > 0; --i)
+		{
+			RelativeSpawnLocationPool.Swap(i, FMath::RandRange(0, i));
+		}
+		NextSpawnPoolIndex = 0;
+	}
+
+	OutLocation = GetSpawnPoolFrame().TransformPosition(RelativeSpawnLocationPool[NextSpawnPoolIndex++]);
+	return true;
 }
 
 // Called when the game starts or when spawned
 void AAISpawnPoint::BeginPlay()
 {
 	Super::BeginPlay();
-	
+
+	if (bRebuildSpawnPoolOnBeginPlay || RelativeSpawnLocationPool.IsEmpty()) BuildSpawnLocationPool();
 }
 
 // Called every frame
@@ -2,8 +2,6 @@
 
 
 #include "Systems/AISpawningSystem/AISpawnSingle.h"
-#include "NavigationSystem.h" 
-#include "NavigationPath.h"
 
 // Sets default values
 AAISpawnSingle::AAISpawnSingle()
@@ -81,86 +79,36 @@ void AAISpawnSingle::HandleSpawn()
 
 			if (ChosenEnemy)
 			{
-				UNavigationSystemV1* NavSystem = UNavigationSystemV1::GetCurrent(GetWorld());
-				if (NavSystem)
+				// precomputed, navmesh-projected and ground-snapped; no nav or trace queries per spawn
+				FVector SpawnLocation;
+				if (DrawSpawnLocation(SpawnLocation))
 				{
-					FNavLocation ValidSpawnLocation;
-					FVector Origin = GetActorLocation();
-
-					// Pick a random point inside the box defined by SpawnSearchRadius
-					FVector RandomOffset(
-						FMath::FRandRange(-SpawnSearchRadius.X, SpawnSearchRadius.X),
-						FMath::FRandRange(-SpawnSearchRadius.Y, SpawnSearchRadius.Y),
-						FMath::FRandRange(-SpawnSearchRadius.Z, SpawnSearchRadius.Z)
+					FVector FinalSpawnLocation = SpawnLocation + FVector(0.f, 0.f, SpawnOffset);
+
+					FActorSpawnParameters SpawnParams;
+					SpawnParams.Owner = this;
+					SpawnParams.SpawnCollisionHandlingOverride = ESpawnActorCollisionHandlingMethod::AlwaysSpawn;
+
+					//Spawn enemy at the pooled location
+					AAICharacterBase* SpawnedEnemy = GetWorld()->SpawnActor<AAICharacterBase>(
+						ChosenEnemy,
+						FinalSpawnLocation,
+						GetActorRotation(), // Keep the same rotation as the spawner
+						SpawnParams
 					);
 
-					FVector TestPoint = Origin + RandomOffset;
-
-					// Project the random point onto the NavMesh to make sure it’s valid
-					bool bFoundLocation = NavSystem->ProjectPointToNavigation(
-						TestPoint,
-						ValidSpawnLocation,
-						SpawnSearchRadius // Use the extents as the query extent
-					);
-
-					if (bFoundLocation)
-					{
-						FVector SpawnLocation = ValidSpawnLocation.Location;
-						FVector SpawnOffsetTotal = FVector(0.f, 0.f, SpawnOffset);   
-
-						FVector FinalSpawnLocation = ValidSpawnLocation.Location + SpawnOffsetTotal;
-						// Start above the NavMesh point and trace downward
-						FVector TraceStart = SpawnLocation + FVector(0.f, 0.f, 500.f); // 500 units above
-						FVector TraceEnd   = SpawnLocation - FVector(0.f, 0.f, 1000.f); // Trace down 1000 units
-
-						FHitResult HitResult;
-						FCollisionQueryParams QueryParams;
-						QueryParams.bTraceComplex = true;
-						QueryParams.AddIgnoredActor(this); // Ignore the spawner
-
-						// Perform the line trace to detect the floor
-						bool bHit = GetWorld()->LineTraceSingleByChannel(
-							HitResult,
-							TraceStart,
-							TraceEnd,
-							ECC_WorldStatic, // Trace against static world geometry (floor, walls, etc.)
-							QueryParams
-						);
-
-						if (bHit)
-						{
-							// Use the surface impact point as the final spawn location
-							SpawnLocation = HitResult.ImpactPoint;
-						}
-						else
-						{
-							UE_LOG(LogTemp, Warning, TEXT("No ground detected, using raw NavMesh location."));
-						}
-						FActorSpawnParameters SpawnParams;
-						SpawnParams.Owner = this;
-						SpawnParams.SpawnCollisionHandlingOverride = ESpawnActorCollisionHandlingMethod::AlwaysSpawn;
-
-						//Spawn enemy at the valid NavMesh point
-						AAICharacterBase* SpawnedEnemy = GetWorld()->SpawnActor<AAICharacterBase>(
-							ChosenEnemy,
-							FinalSpawnLocation,
-							GetActorRotation(), // Keep the same rotation as the spawner
-							SpawnParams
-						);
-
-						if (SpawnedEnemy)
-						{
-							SpawnedEnemy->SpawnBrain = SpawnerBrain;
-							SpawnerBrain->ActiveEnemies.AddUnique(SpawnedEnemy);
-						}
-
-						AssignedSpawnerTrigger->EnemiesThatHaveSpawned++;
-						EnemiesThisSpawnerSpawned++;
-					}
-					else
+					if (SpawnedEnemy)
 					{
-						UE_LOG(LogTemp, Warning, TEXT("No valid NavMesh point found for spawning!"));
+						SpawnedEnemy->SpawnBrain = SpawnerBrain;
+						SpawnerBrain->RegisterActiveEnemy(SpawnedEnemy);
 					}
+
+					AssignedSpawnerTrigger->EnemiesThatHaveSpawned++;
+					EnemiesThisSpawnerSpawned++;
+				}
+				else
+				{
+					UE_LOG(LogTemp, Warning, TEXT("No valid NavMesh point found for spawning!"));
 				}
 			}
 		}
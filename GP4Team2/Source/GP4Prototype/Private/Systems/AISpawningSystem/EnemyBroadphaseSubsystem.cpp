@@ -0,0 +1,282 @@
+#include "Systems/AISpawningSystem/EnemyBroadphaseSubsystem.h"
+
+#include "Character/AICharacterBase.h"
+#include "Core/Data/Interfaces/Damageable.h"
+#include "EngineUtils.h"
+#include "HAL/IConsoleManager.h"
+
+static TAutoConsoleVariable<int32> CVarEnemyBroadphase(
+	TEXT("GP4.Combat.EnemyBroadphase"), 1,
+	TEXT("1: melee, dash and slide hits skip their sweeps when the grid has no enemy or damageable nearby. 0: always sweep."),
+	ECVF_Default);
+
+namespace EnemyBroadphase
+{
+	// Past this many cells a query just walks every entry
+	constexpr int32 MaxCellsPerQuery = 64;
+}
+
+bool UEnemyBroadphaseSubsystem::IsBroadphaseEnabled()
+{
+	return CVarEnemyBroadphase.GetValueOnGameThread() != 0;
+}
+
+template <typename FunctorType>
+void UEnemyBroadphaseSubsystem::ForEachCandidate(const FVector& Start, const FVector& End, float Radius, FunctorType&& Functor) const
+{
+	if (Entries.Num() == 0) return;
+
+	// Functor returns false to stop early
+	auto Visit = [&](int32 Index)
+	{
+		const FGridEntry& Entry = Entries[Index];
+		AActor* Actor = Entry.Actor.Get();
+		if (!Actor) return true;
+		if (FMath::PointDistToSegmentSquared(Entry.Location, Start, End) > FMath::Square(Radius + Entry.Extent)) return true;
+		return Functor(Actor, Entry.bEnemy);
+	};
+
+	const float Reach = Radius + MaxExtent;
+	const FIntPoint MinCell = GetCell(Start.ComponentMin(End) - FVector(Reach));
+	const FIntPoint MaxCell = GetCell(Start.ComponentMax(End) + FVector(Reach));
+	const int64 CellCount = static_cast<int64>(MaxCell.X - MinCell.X + 1) * (MaxCell.Y - MinCell.Y + 1);
+
+	if (CellCount > EnemyBroadphase::MaxCellsPerQuery || CellCount > Entries.Num())
+	{
+		for (auto It = Entries.CreateConstIterator(); It; ++It)
+		{
+			if (!Visit(It.GetIndex())) return;
+		}
+		return;
+	}
+
+	for (int32 X = MinCell.X; X <= MaxCell.X; ++X)
+	{
+		for (int32 Y = MinCell.Y; Y <= MaxCell.Y; ++Y)
+		{
+			const TArray<int32, TInlineAllocator<4>>* Cell = Cells.Find(FIntPoint(X, Y));
+			if (!Cell) continue;
+
+			for (const int32 Index : *Cell)
+			{
+				if (!Visit(Index)) return;
+			}
+		}
+	}
+}
+
+void UEnemyBroadphaseSubsystem::Deinitialize()
+{
+	if (ActorSpawnedHandle.IsValid())
+	{
+		GetWorld()->RemoveOnActorSpawnedHandler(ActorSpawnedHandle);
+		ActorSpawnedHandle.Reset();
+	}
+
+	Entries.Empty();
+	EntryIndices.Empty();
+	DamageableIndices.Empty();
+	Cells.Empty();
+
+	Super::Deinitialize();
+}
+
+void UEnemyBroadphaseSubsystem::ActivateGrid(float InCellSize)
+{
+	InCellSize = FMath::Max(InCellSize, 50.f);
+	if (!FMath::IsNearlyEqual(InCellSize, CellSize))
+	{
+		CellSize = InCellSize;
+		RebuildCells();
+	}
+
+	if (bGridActive) return;
+	bGridActive = true;
+
+	// Gated sweeps must still reach props that take damage, so the grid tracks them alongside the enemies
+	UWorld* World = GetWorld();
+	for (TActorIterator<AActor> It(World); It; ++It)
+	{
+		if (IsNonEnemyDamageable(*It)) AddDamageable(*It);
+	}
+	ActorSpawnedHandle = World->AddOnActorSpawnedHandler(FOnActorSpawned::FDelegate::CreateUObject(this, &UEnemyBroadphaseSubsystem::OnActorSpawned));
+}
+
+void UEnemyBroadphaseSubsystem::AddEnemy(AAICharacterBase* Enemy)
+{
+	if (!IsValid(Enemy)) return;
+	AddEntry(Enemy, true);
+}
+
+void UEnemyBroadphaseSubsystem::RemoveEnemy(AAICharacterBase* Enemy)
+{
+	if (const int32* Index = EntryIndices.Find(Enemy))
+	{
+		RemoveAt(*Index);
+	}
+}
+
+void UEnemyBroadphaseSubsystem::AddDamageable(AActor* Actor)
+{
+	if (!IsValid(Actor)) return;
+	const int32 Index = AddEntry(Actor, false);
+	if (Index != INDEX_NONE) DamageableIndices.Add(Index);
+}
+
+void UEnemyBroadphaseSubsystem::RemoveDamageable(AActor* Actor)
+{
+	if (const int32* Index = EntryIndices.Find(Actor))
+	{
+		RemoveAt(*Index);
+	}
+}
+
+int32 UEnemyBroadphaseSubsystem::AddEntry(AActor* Actor, bool bEnemy)
+{
+	if (EntryIndices.Contains(Actor)) return INDEX_NONE;
+
+	FGridEntry Entry;
+	Entry.Actor = Actor;
+	Entry.Key = Actor;
+	Entry.bEnemy = bEnemy;
+	const int32 Index = Entries.Add(MoveTemp(Entry));
+	EntryIndices.Add(Actor, Index);
+
+	Entries[Index].Cell = GetCell(Actor->GetActorLocation());
+	Cells.FindOrAdd(Entries[Index].Cell).Add(Index);
+	RefreshEntry(Index, Actor);
+	return Index;
+}
+
+void UEnemyBroadphaseSubsystem::OnActorSpawned(AActor* Actor)
+{
+	if (IsNonEnemyDamageable(Actor)) AddDamageable(Actor);
+}
+
+bool UEnemyBroadphaseSubsystem::IsNonEnemyDamageable(const AActor* Actor)
+{
+	// Enemies are owned by the spawn brains, which add and remove them themselves
+	return IsValid(Actor) && !Actor->IsA<AAICharacterBase>() && Actor->GetClass()->ImplementsInterface(UDamageable::StaticClass());
+}
+
+void UEnemyBroadphaseSubsystem::UpdateEnemies(const TArray<AAICharacterBase*>& Enemies)
+{
+	for (AAICharacterBase* Enemy : Enemies)
+	{
+		const int32* Index = EntryIndices.Find(Enemy);
+		if (!IsValid(Enemy))
+		{
+			if (Index) RemoveAt(*Index);
+			continue;
+		}
+
+		if (!Index)
+		{
+			AddEnemy(Enemy);
+			continue;
+		}
+		RefreshEntry(*Index, Enemy);
+	}
+}
+
+void UEnemyBroadphaseSubsystem::UpdateDamageables()
+{
+	// Copy: RemoveAt edits the set
+	for (const int32 Index : DamageableIndices.Array())
+	{
+		const AActor* Actor = Entries[Index].Actor.Get();
+		if (!IsValid(Actor))
+		{
+			RemoveAt(Index);
+			continue;
+		}
+		RefreshEntry(Index, Actor);
+	}
+}
+
+int32 UEnemyBroadphaseSubsystem::QuerySweptSphere(const FVector& Start, const FVector& End, float Radius, FEnemyCandidateList& OutEnemies) const
+{
+	OutEnemies.Reset();
+	ForEachCandidate(Start, End, Radius, [&OutEnemies](AActor* Actor, bool bEnemy)
+	{
+		if (bEnemy) OutEnemies.Add(CastChecked<AAICharacterBase>(Actor));
+		return true;
+	});
+	return OutEnemies.Num();
+}
+
+bool UEnemyBroadphaseSubsystem::MayOverlapTargets(const FVector& Start, const FVector& End, float Radius, const AActor* IgnoreActor) const
+{
+	if (!IsBroadphaseEnabled() || !bGridActive) return true;
+
+	bool bFound = false;
+	ForEachCandidate(Start, End, Radius, [&bFound, IgnoreActor](AActor* Actor, bool)
+	{
+		if (Actor == IgnoreActor) return true;
+		bFound = true;
+		return false;
+	});
+	return bFound;
+}
+
+FIntPoint UEnemyBroadphaseSubsystem::GetCell(const FVector& Location) const
+{
+	return FIntPoint(FMath::FloorToInt32(Location.X / CellSize), FMath::FloorToInt32(Location.Y / CellSize));
+}
+
+void UEnemyBroadphaseSubsystem::RefreshEntry(int32 Index, const AActor* Actor)
+{
+	FGridEntry& Entry = Entries[Index];
+	if (Entry.bEnemy)
+	{
+		// sphere around the capsule
+		Entry.Location = Actor->GetActorLocation();
+		float CollisionRadius = 0.f;
+		float CollisionHalfHeight = 0.f;
+		Actor->GetSimpleCollisionCylinder(CollisionRadius, CollisionHalfHeight);
+		Entry.Extent = FMath::Max(CollisionRadius, CollisionHalfHeight);
+	}
+	else
+	{
+		// props are rarely centered on their pivot; use the colliding bounds instead
+		const FBox Bounds = Actor->GetComponentsBoundingBox();
+		Entry.Location = Bounds.IsValid ? Bounds.GetCenter() : Actor->GetActorLocation();
+		Entry.Extent = Bounds.IsValid ? Bounds.GetExtent().Size() : 0.f;
+	}
+	MaxExtent = FMath::Max(MaxExtent, Entry.Extent);
+
+	const FIntPoint NewCell = GetCell(Entry.Location);
+	if (NewCell == Entry.Cell) return;
+
+	if (TArray<int32, TInlineAllocator<4>>* OldCell = Cells.Find(Entry.Cell))
+	{
+		OldCell->RemoveSingleSwap(Index);
+		if (OldCell->IsEmpty()) Cells.Remove(Entry.Cell);
+	}
+	Entry.Cell = NewCell;
+	Cells.FindOrAdd(NewCell).Add(Index);
+}
+
+void UEnemyBroadphaseSubsystem::RemoveAt(int32 Index)
+{
+	const FGridEntry& Entry = Entries[Index];
+	if (TArray<int32, TInlineAllocator<4>>* Cell = Cells.Find(Entry.Cell))
+	{
+		Cell->RemoveSingleSwap(Index);
+		if (Cell->IsEmpty()) Cells.Remove(Entry.Cell);
+	}
+
+	EntryIndices.Remove(Entry.Key);
+	DamageableIndices.Remove(Index);
+	Entries.RemoveAt(Index);
+}
+
+void UEnemyBroadphaseSubsystem::RebuildCells()
+{
+	Cells.Reset();
+	for (auto It = Entries.CreateIterator(); It; ++It)
+	{
+		It->Cell = GetCell(It->Location);
+		Cells.FindOrAdd(It->Cell).Add(It.GetIndex());
+	}
+}
@@ -2,3 +2,145 @@
 
 
 #include "GP4Prototype/Public/Systems/AttributeSystem/AgentData.h"
+#include "Systems/AttributeSystem/AttributeStore.h"
+#include "Systems/AttributeSystem/AttributeStats.h"
+#include "UObject/ObjectSaveContext.h"
+
+namespace AgentDataBake
+{
+	TArray<FAgentAttributeBaked> BakeEntries(const UAgentData& Data)
+	{
+		SCOPE_CYCLE_COUNTER(STAT_AttributeBake);
+
+		TArray<FAgentAttributeBaked> Baked;
+		Baked.Reserve(Data.Attributes.Num());
+		TMap<FGameplayTag, int32> Seen;
+
+		for (const FAgentAttribute& Entry : Data.Attributes)
+		{
+			if (!Entry.AttributeTag.IsValid())
+			{
+				UE_LOG(LogTemp, Warning, TEXT("%s: attribute entry without a tag skipped"), *Data.GetName());
+				continue;
+			}
+
+			// Later duplicates win, as they did when entries were applied one by one
+			FAgentAttributeBaked* Out = nullptr;
+			if (const int32* Existing = Seen.Find(Entry.AttributeTag))
+			{
+				UE_LOG(LogTemp, Warning, TEXT("%s: duplicate attribute '%s', the last entry is used"), *Data.GetName(), *Entry.AttributeTag.ToString());
+				Out = &Baked[*Existing];
+			}
+			else
+			{
+				Seen.Add(Entry.AttributeTag, Baked.Num());
+				Out = &Baked.AddDefaulted_GetRef();
+			}
+
+			FAttribute Attr;
+			Attr.BaseValue = Entry.BaseValue;
+			Attr.NumericType = Entry.NumericType;
+			Attr.RoundingMode = Entry.RoundingMode;
+			Attr.ClampMode = Entry.ClampMode;
+			Attr.ClampValue = Entry.ClampValue;
+			if (Attr.NumericType == EAttributeNumericType::Integer)
+			{
+				Attr.BaseValue = static_cast<float>(FMath::RoundToInt(Attr.BaseValue));
+				if (Attr.ClampMode != EAttributeClampMode::None)
+				{
+					Attr.ClampValue = static_cast<float>(FMath::RoundToInt(Attr.ClampValue));
+				}
+			}
+			Attr.Recalculate();
+
+			// A clamp that immediately overrides the base is usually a data mistake (common cause of unexpected zeros)
+			if (Attr.ClampMode == EAttributeClampMode::Max && Attr.ClampValue < Attr.BaseValue)
+			{
+				UE_LOG(LogTemp, Warning, TEXT("%s: attribute '%s' is clamped by Max ClampValue %.2f (Base=%.2f)"), *Data.GetName(), *Entry.AttributeTag.ToString(), Attr.ClampValue, Attr.BaseValue);
+			}
+			else if (Attr.ClampMode == EAttributeClampMode::Min && Attr.ClampValue > Attr.BaseValue)
+			{
+				UE_LOG(LogTemp, Warning, TEXT("%s: attribute '%s' is raised by Min ClampValue %.2f (Base=%.2f)"), *Data.GetName(), *Entry.AttributeTag.ToString(), Attr.ClampValue, Attr.BaseValue);
+			}
+
+			Out->AttributeTag = Entry.AttributeTag;
+			Out->NativeIndex = AttributeTags::FindNativeIndex(Entry.AttributeTag);
+			Out->BaseValue = Attr.BaseValue;
+			Out->Value = Attr.Value;
+			Out->ClampValue = Attr.ClampValue;
+			Out->NumericType = Attr.NumericType;
+			Out->RoundingMode = Attr.RoundingMode;
+			Out->ClampMode = Attr.ClampMode;
+		}
+
+		// Natives in index order, then extra tags, so the template fills its arrays front to back
+		Baked.StableSort([](const FAgentAttributeBaked& A, const FAgentAttributeBaked& B)
+		{
+			return static_cast<uint32>(A.NativeIndex) < static_cast<uint32>(B.NativeIndex);
+		});
+		return Baked;
+	}
+}
+
+TSharedRef<const FAttributeTemplate> UAgentData::GetAttributeTemplate() const
+{
+	if (!AttributeTemplate.IsValid())
+	{
+		AttributeTemplate = AreBakedAttributesValid()
+			? FAttributeTemplate::Build(BakedAttributes)
+			: FAttributeTemplate::Build(AgentDataBake::BakeEntries(*this));
+	}
+	return AttributeTemplate.ToSharedRef();
+}
+
+void UAgentData::BakeAttributes()
+{
+	BakedAttributes = AgentDataBake::BakeEntries(*this);
+	bAttributesBaked = true;
+	AttributeTemplate.Reset();
+}
+
+bool UAgentData::AreBakedAttributesValid() const
+{
+	if (!bAttributesBaked)
+	{
+		return false;
+	}
+	// Indices are only as good as the native table they were baked against
+	for (const FAgentAttributeBaked& Entry : BakedAttributes)
+	{
+		if (Entry.NativeIndex != AttributeTags::FindNativeIndex(Entry.AttributeTag))
+		{
+			return false;
+		}
+	}
+	return true;
+}
+
+void UAgentData::PostLoad()
+{
+	Super::PostLoad();
+
+	// In the editor the source may be newer than the last save; cooked data is trusted once validated
+	if (GIsEditor || !AreBakedAttributesValid())
+	{
+		BakeAttributes();
+	}
+	AttributeTemplate = FAttributeTemplate::Build(BakedAttributes);
+}
+
+#if WITH_EDITOR
+void UAgentData::PreSave(FObjectPreSaveContext SaveContext)
+{
+	BakeAttributes();
+	Super::PreSave(SaveContext);
+}
+
+void UAgentData::PostEditChangeProperty(FPropertyChangedEvent& PropertyChangedEvent)
+{
+	Super::PostEditChangeProperty(PropertyChangedEvent);
+
+	// Components already sharing the old template keep it; new ones pick up the edit
+	BakeAttributes();
+}
+#endif
@@ -10,6 +10,12 @@
 #include "TimerManager.h"
 #include "Engine/World.h"
 #include "Systems/AttributeSystem/AttributeTags.h"
+#include "Systems/AttributeSystem/AttributeStats.h"
+
+DEFINE_STAT(STAT_AttributeInit);
+DEFINE_STAT(STAT_AttributeBake);
+DEFINE_STAT(STAT_AttributeSharedInits);
+DEFINE_STAT(STAT_AttributeCopiedInits);
 
 // -- Lifecycle --
 #pragma region Lifecycle
@@ -66,13 +72,25 @@ FAttribute UAttributeComponent::GetAttribute(FGameplayTag tag)
 	return FAttribute();
 }
 
+TMap<FGameplayTag, FAttribute> UAttributeComponent::GetAttributes() const
+{
+	TMap<FGameplayTag, FAttribute> Result;
+	Result.Reserve(Attributes.Num());
+	for (int32 Index = 0; Index < Attributes.Num(); ++Index)
+	{
+		if (Attributes.IsRegistered(Index)) Result.Add(Attributes.GetTag(Index), Attributes.GetRecord(Index));
+	}
+	return Result;
+}
+
 FGameplayTag UAttributeComponent::GetAttributeTag(FAttribute attribute)
 {
-	for (const auto& Elem : Attributes)
+	for (int32 Index = 0; Index < Attributes.Num(); ++Index)
 	{
-		if (Elem.Value.BaseValue == attribute.BaseValue && Elem.Value.Value == attribute.Value)
+		if (Attributes.IsRegistered(Index)
+			&& Attributes.GetBaseValue(Index) == attribute.BaseValue && Attributes.GetValue(Index) == attribute.Value)
 		{
-			return Elem.Key;
+			return Attributes.GetTag(Index);
 		}
 	}
 	return FGameplayTag();
@@ -80,22 +98,14 @@ FGameplayTag UAttributeComponent::GetAttributeTag(FAttribute attribute)
 
 float UAttributeComponent::GetAttributeBaseValue(FGameplayTag tag) const
 {
-	auto attribute = Attributes.Find(tag);
-	if (attribute != nullptr)
-	{
-		return attribute->BaseValue;
-	}
-	return 0.0f;
+	const int32 Index = Attributes.FindIndex(tag);
+	return Index != INDEX_NONE ? Attributes.GetBaseValue(Index) : 0.0f;
 }
 
 float UAttributeComponent::GetAttributeValue(FGameplayTag tag) const
 {
-	auto attribute = Attributes.Find(tag);
-	if (attribute != nullptr)
-	{
-		return attribute->Value;
-	}
-	return 0.0f;
+	const int32 Index = Attributes.FindIndex(tag);
+	return Index != INDEX_NONE ? Attributes.GetValue(Index) : 0.0f;
 }
 
 int32 UAttributeComponent::GetAttributeValueInt(FGameplayTag Tag) const
@@ -110,7 +120,7 @@ float UAttributeComponent::GetAttributeClamped(FGameplayTag Tag, float Min, floa
 
 bool UAttributeComponent::HasAttribute(FGameplayTag Tag) const
 {
-	return Attributes.Contains(Tag);
+	return Attributes.FindIndex(Tag) != INDEX_NONE;
 }
 
 bool UAttributeComponent::HasModifier(FGameplayTag Tag, FGuid ID) const
@@ -137,35 +147,40 @@ int32 UAttributeComponent::GetAppliedModifierRefCountForSource(UObject* Source)
 
 void UAttributeComponent::SetAttributeBaseValue(FGameplayTag tag, float NewValue)
 {
-	if (FAttribute* Attribute = Attributes.Find(tag))
+	const int32 Index = Attributes.FindIndex(tag);
+	if (Index != INDEX_NONE)
 	{
-		if (Attribute->NumericType == EAttributeNumericType::Integer)
+		FAttribute& Attribute = Attributes.EditRecord(Index);
+		if (Attribute.NumericType == EAttributeNumericType::Integer)
 		{
 			NewValue = static_cast<float>(FMath::RoundToInt(NewValue));
 		}
-		const float OldBase = Attribute->BaseValue;
+		const float OldBase = Attribute.BaseValue;
 		if (!FMath::IsNearlyEqual(OldBase, NewValue))
 		{
-			Attribute->BaseValue = NewValue;
-			const float OldValue = Attribute->Value;
-			Attribute->Recalculate();
-			const float NewEffective = Attribute->Value;
+			Attribute.BaseValue = NewValue;
+			const float OldValue = Attribute.Value;
+			RecalculateIndex(Index);
 
 			OnAttributeBaseChanged.Broadcast(tag, OldBase, NewValue);
-
-			if (!FMath::IsNearlyEqual(OldValue, NewEffective))
-			{
-				OnAttributeValueChanged.Broadcast(tag, OldValue, NewEffective);
-				OnAnyAttributeChanged.Broadcast(tag, OldValue, NewEffective);
-			}
+			BroadcastValueChange(Index, OldValue);
 		}
 	}
 }
 
 void UAttributeComponent::SetAttributeValue(FGameplayTag tag, float NewValue)
 {
-	if (FAttribute* Attribute = Attributes.Find(tag))
+	const int32 Index = Attributes.FindIndex(tag);
+	if (Index != INDEX_NONE)
 	{
+		// A pending batched recalculation must not overwrite the value set here
+		if (BatchDirty.IsValidIndex(Index) && BatchDirty[Index])
+		{
+			Attributes.Recalculate(Index);
+			BatchDirty[Index] = false;
+		}
+
+		FAttribute* Attribute = &Attributes.EditRecord(Index);
 		if (Attribute->NumericType == EAttributeNumericType::Integer)
 		{
 			NewValue = static_cast<float>(FMath::RoundToInt(NewValue));
@@ -187,30 +202,24 @@ void UAttributeComponent::SetAttributeValue(FGameplayTag tag, float NewValue)
 		if (!FMath::IsNearlyEqual(OldValue, NewValue))
 		{
 			Attribute->Value = NewValue;
-			OnAttributeValueChanged.Broadcast(tag, OldValue, NewValue);
-			OnAnyAttributeChanged.Broadcast(tag, OldValue, NewValue);
+			Attributes.Sync(Index);
+			BroadcastValueChange(Index, OldValue);
 		}
 	}
 }
 
 void UAttributeComponent::ResetAttribute(FGameplayTag Tag)
 {
-	if (FAttribute* Attr = Attributes.Find(Tag))
+	const int32 Index = Attributes.FindIndex(Tag);
+	if (Index != INDEX_NONE)
 	{
-		if (Attr->ActiveModifiers.Num() > 0)
+		if (Attributes.GetRecord(Index).ActiveModifiers.Num() > 0)
 		{
 			ClearModifiers(Tag);
 		}
 		else
 		{
-			const float OldValue = Attr->Value;
-			Attr->Recalculate();
-			const float NewValue = Attr->Value;
-			if (!FMath::IsNearlyEqual(OldValue, NewValue))
-			{
-				OnAttributeValueChanged.Broadcast(Tag, OldValue, NewValue);
-				OnAnyAttributeChanged.Broadcast(Tag, OldValue, NewValue);
-			}
+			CommitAttribute(Index, Attributes.GetValue(Index));
 		}
 	}
 }
@@ -221,8 +230,10 @@ void UAttributeComponent::ResetAttribute(FGameplayTag Tag)
 
 void UAttributeComponent::AddModifier(FGameplayTag Tag, const FModifier& Modifier)
 {
-	if (FAttribute* Attribute = Attributes.Find(Tag))
+	const int32 Index = Attributes.FindIndex(Tag);
+	if (Index != INDEX_NONE)
 	{
+		FAttribute& Attribute = Attributes.EditRecord(Index);
 		FModifier Copy = Modifier;
 		if (!Copy.ModifierID.IsValid())
 		{
@@ -230,7 +241,7 @@ void UAttributeComponent::AddModifier(FGameplayTag Tag, const FModifier& Modifie
 		}
 
 		// If this attribute is Integer-typed, coerce Addition/Override values to int
-		if (Attribute->NumericType == EAttributeNumericType::Integer)
+		if (Attribute.NumericType == EAttributeNumericType::Integer)
 		{
 			if (Copy.Type == EModificationType::Addition || Copy.Type == EModificationType::Override)
 			{
@@ -238,19 +249,14 @@ void UAttributeComponent::AddModifier(FGameplayTag Tag, const FModifier& Modifie
 			}
 		}
 		
-		Attribute->ActiveModifiers.Add(Copy);
+		const float OldValue = Attribute.Value;
+		Attribute.AddModifier(Copy);
 
+		// Listeners may edit other attributes, which can move this record; only the index is used after this
 		OnAttributeModified.Broadcast(Tag, Copy);
 
 		// Recalculate and broadcast change if any
-		const float OldValue = Attribute->Value;
-		Attribute->Recalculate();
-		const float NewValue = Attribute->Value;
-		if (!FMath::IsNearlyEqual(OldValue, NewValue))
-		{
-			OnAttributeValueChanged.Broadcast(Tag, OldValue, NewValue);
-			OnAnyAttributeChanged.Broadcast(Tag, OldValue, NewValue);
-		}
+		CommitAttribute(Index, OldValue);
 	}
 }
 
@@ -288,18 +294,23 @@ FGuid UAttributeComponent::AddTemporaryModifier(FGameplayTag Tag, const FModifie
 
 void UAttributeComponent::AddModifiers(FGameplayTag Tag, const TArray<FModifier>& Modifiers)
 {
+	BeginBatch();
 	for (const FModifier& M : Modifiers)
 	{
 		AddModifier(Tag, M);
 	}
+	EndBatch();
 }
 
 
 void UAttributeComponent::RemoveModifier(FGameplayTag Tag, const FModifier& Modifier)
 {
-	if (FAttribute* Attribute = Attributes.Find(Tag))
+	const int32 Index = Attributes.FindIndex(Tag);
+	if (Index != INDEX_NONE && Attributes.GetRecord(Index).ActiveModifiers.Num() > 0)
 	{
-		int32 Removed = Attribute->ActiveModifiers.RemoveAll([&](const FModifier& M)
+		FAttribute& Attribute = Attributes.EditRecord(Index);
+		const float OldValue = Attribute.Value;
+		int32 Removed = Attribute.RemoveModifiers([&](const FModifier& M)
 		{
 			// Prefer exact ID match when available; otherwise fall back to a conservative field comparison
 			if (Modifier.ModifierID.IsValid())
@@ -313,43 +324,32 @@ void UAttributeComponent::RemoveModifier(FGameplayTag Tag, const FModifier& Modi
 		if (Removed > 0)
 		{
 			OnAttributeModified.Broadcast(Tag, Modifier);
-
-			const float OldValue = Attribute->Value;
-			Attribute->Recalculate();
-			const float NewValue = Attribute->Value;
-			if (!FMath::IsNearlyEqual(OldValue, NewValue))
-			{
-				OnAttributeValueChanged.Broadcast(Tag, OldValue, NewValue);
-				OnAnyAttributeChanged.Broadcast(Tag, OldValue, NewValue);
-			}
+			CommitAttribute(Index, OldValue);
 		}
 	}
 }
 
 void UAttributeComponent::ClearModifiers(FGameplayTag Tag)
 {
-	if (FAttribute* Attribute = Attributes.Find(Tag))
+	const int32 Index = Attributes.FindIndex(Tag);
+	if (Index != INDEX_NONE)
 	{
-		if (Attribute->ActiveModifiers.Num() == 0)
+		if (Attributes.GetRecord(Index).ActiveModifiers.Num() == 0)
 		{
 			return;
 		}
+		// Copied: listeners may edit attributes while we broadcast, which can move the record
+		const TArray<FModifier> Removed = Attributes.GetRecord(Index).ActiveModifiers;
+		const float OldValue = Attributes.GetValue(Index);
 
 		// Broadcast each removal for traceability
-		for (const FModifier& M : Attribute->ActiveModifiers)
+		for (const FModifier& M : Removed)
 		{
 			OnAttributeModified.Broadcast(Tag, M);
 		}
 
-		const float OldValue = Attribute->Value;
-		Attribute->ActiveModifiers.Empty();
-		Attribute->Recalculate();
-		const float NewValue = Attribute->Value;
-		if (!FMath::IsNearlyEqual(OldValue, NewValue))
-		{
-			OnAttributeValueChanged.Broadcast(Tag, OldValue, NewValue);
-			OnAnyAttributeChanged.Broadcast(Tag, OldValue, NewValue);
-		}
+		Attributes.EditRecord(Index).ClearModifiers();
+		CommitAttribute(Index, OldValue);
 	}
 }
 
@@ -400,38 +400,26 @@ void UAttributeComponent::RemoveAllModifiersFromSourceObject(UObject* Source)
 	TArray<FAppliedModifierRef> Refs = *RefsPtr;
 	SourceAppliedModifiers.Remove(Source);
 
+	BeginBatch();
 	for (const FAppliedModifierRef& Ref : Refs)
 	{
-		if (FAttribute* Attr = Attributes.Find(Ref.Tag))
+		const int32 Index = Attributes.FindIndex(Ref.Tag);
+		if (Index != INDEX_NONE && Attributes.GetRecord(Index).ActiveModifiers.Num() > 0)
 		{
+			FAttribute* Attr = &Attributes.EditRecord(Index);
 			const float OldValue = Attr->Value;
-			bool bAnyRemoved = false;
-			Attr->ActiveModifiers.RemoveAll([&](const FModifier& M)
-			{
-				if (M.ModifierID == Ref.ModifierID)
-				{
-					bAnyRemoved = true;
-					return true;
-				}
-				return false;
-			});
+			const int32 Removed = Attr->RemoveModifiers([&](const FModifier& M){ return M.ModifierID == Ref.ModifierID; });
 
-			if (bAnyRemoved)
+			if (Removed > 0)
 			{
 				// Emit a minimal modified event carrying the ID
 				FModifier Temp; Temp.ModifierID = Ref.ModifierID;
 				OnAttributeModified.Broadcast(Ref.Tag, Temp);
-
-				Attr->Recalculate();
-				const float NewValue = Attr->Value;
-				if (!FMath::IsNearlyEqual(OldValue, NewValue))
-				{
-					OnAttributeValueChanged.Broadcast(Ref.Tag, OldValue, NewValue);
-					OnAnyAttributeChanged.Broadcast(Ref.Tag, OldValue, NewValue);
-				}
+				CommitAttribute(Index, OldValue);
 			}
 		}
 	}
+	EndBatch();
 }
 
 // Convenience: remove by ID, auto-resolving tag if needed
@@ -449,11 +437,11 @@ bool UAttributeComponent::RemoveModifierByID(FGameplayTag Tag, FGuid ModifierID)
 		else
 		{
 			// Fallback: scan attributes to find which tag contains this modifier
-			for (const auto& KVP : Attributes)
+			for (int32 Index = 0; Index < Attributes.Num(); ++Index)
 			{
-				if (KVP.Value.ActiveModifiers.ContainsByPredicate([&](const FModifier& M){ return M.ModifierID == ModifierID; }))
+				if (Attributes.GetRecord(Index).ActiveModifiers.ContainsByPredicate([&](const FModifier& M){ return M.ModifierID == ModifierID; }))
 				{
-					TagToUse = KVP.Key;
+					TagToUse = Attributes.GetTag(Index);
 					break;
 				}
 			}
@@ -462,23 +450,18 @@ bool UAttributeComponent::RemoveModifierByID(FGameplayTag Tag, FGuid ModifierID)
 
 	if (!TagToUse.IsValid()) return false;
 
-	if (FAttribute* Attribute = Attributes.Find(TagToUse))
+	const int32 Index = Attributes.FindIndex(TagToUse);
+	if (Index != INDEX_NONE && Attributes.GetRecord(Index).ActiveModifiers.Num() > 0)
 	{
+		FAttribute* Attribute = &Attributes.EditRecord(Index);
 		const float OldValue = Attribute->Value;
-		int32 Removed = Attribute->ActiveModifiers.RemoveAll([&](const FModifier& M){ return M.ModifierID == ModifierID; });
+		int32 Removed = Attribute->RemoveModifiers([&](const FModifier& M){ return M.ModifierID == ModifierID; });
 		if (Removed > 0)
 		{
 			// Emit minimal modified event
 			FModifier Temp; Temp.ModifierID = ModifierID;
 			OnAttributeModified.Broadcast(TagToUse, Temp);
-
-			Attribute->Recalculate();
-			const float NewValue = Attribute->Value;
-			if (!FMath::IsNearlyEqual(OldValue, NewValue))
-			{
-				OnAttributeValueChanged.Broadcast(TagToUse, OldValue, NewValue);
-				OnAnyAttributeChanged.Broadcast(TagToUse, OldValue, NewValue);
-			}
+			CommitAttribute(Index, OldValue);
 			return true;
 		}
 	}
@@ -571,28 +554,82 @@ void UAttributeComponent::HandleTempModifierExpired(FGuid ModifierID)
 
 void UAttributeComponent::RecalculateAttribute(FGameplayTag Tag)
 {
-	if (FAttribute* Attribute = Attributes.Find(Tag))
+	const int32 Index = Attributes.FindIndex(Tag);
+	if (Index != INDEX_NONE)
 	{
-		const float OldValue = Attribute->Value;
-		Attribute->Recalculate();
-		const float NewValue = Attribute->Value;
-		if (!FMath::IsNearlyEqual(OldValue, NewValue))
-		{
-			OnAttributeValueChanged.Broadcast(Tag, OldValue, NewValue);
-			OnAnyAttributeChanged.Broadcast(Tag, OldValue, NewValue);
-		}
+		CommitAttribute(Index, Attributes.GetValue(Index));
 	}
 }
 
 void UAttributeComponent::RecalculateAll()
 {
-	for (auto& KVP : Attributes)
+	BeginBatch();
+	for (int32 Index = 0; Index < Attributes.Num(); ++Index)
 	{
-		RecalculateAttribute(KVP.Key);
+		CommitAttribute(Index, Attributes.GetValue(Index));
 	}
+	EndBatch();
 }
 #pragma endregion BlueprintAPI_Recalculate
 
+// -- Blueprint API: Batching --
+#pragma region BlueprintAPI_Batch
+
+void UAttributeComponent::BeginBatch()
+{
+	if (BatchDepth++ == 0)
+	{
+		BatchDirty.Init(false, Attributes.Num());
+		BatchPending.Init(false, Attributes.Num());
+	}
+}
+
+void UAttributeComponent::EndBatch()
+{
+	if (!ensureMsgf(BatchDepth > 0, TEXT("UAttributeComponent::EndBatch without a matching BeginBatch")))
+	{
+		return;
+	}
+	if (--BatchDepth > 0)
+	{
+		return;
+	}
+
+	for (TConstSetBitIterator<> It(BatchDirty); It; ++It)
+	{
+		Attributes.Recalculate(It.GetIndex());
+	}
+	BatchDirty.Reset();
+	BatchPending.Reset();
+
+	// Listeners may start another batch, so broadcast from local copies
+	const TArray<int32> PendingIndices = MoveTemp(BatchPendingIndices);
+	const TArray<float> PendingOldValues = MoveTemp(BatchPendingOldValues);
+	const int32 Deferred = BatchDeferredChanges;
+	BatchPendingIndices.Reset();
+	BatchPendingOldValues.Reset();
+	BatchDeferredChanges = 0;
+
+	int32 Emitted = 0;
+	for (int32 i = 0; i < PendingIndices.Num(); ++i)
+	{
+		const int32 Index = PendingIndices[i];
+		const float OldValue = PendingOldValues[i];
+		const float NewValue = Attributes.GetValue(Index);
+		if (!FMath::IsNearlyEqual(OldValue, NewValue))
+		{
+			const FGameplayTag& Tag = Attributes.GetTag(Index);
+			OnAttributeValueChanged.Broadcast(Tag, OldValue, NewValue);
+			OnAnyAttributeChanged.Broadcast(Tag, OldValue, NewValue);
+			++Emitted;
+		}
+	}
+
+	// Every deferred change could have fired both value delegates; only the coalesced ones did
+	BroadcastsSaved += 2 * (Deferred - Emitted);
+}
+#pragma endregion BlueprintAPI_Batch
+
 // -- Internal API --
 #pragma region InternalAPI
 
@@ -610,54 +647,86 @@ void UAttributeComponent::InitializeFromAgentData(UAgentData* newAgentData)
 	if (bAttributesInitialized && newAgentData == AgentData) return; 
 	AgentData = newAgentData;
 
-	// Do NOT clear the map to preserve references returned by RegisterAndGetAttribute
-	for (const FAgentAttribute & Entry : newAgentData->Attributes)
-	{
-		FAttribute & Attr = Attributes.FindOrAdd(Entry.AttributeTag);
+	SCOPE_CYCLE_COUNTER(STAT_AttributeInit);
+	const TSharedRef<const FAttributeTemplate> Template = newAgentData->GetAttributeTemplate();
 
-		const float OldBase = Attr.BaseValue;
-		const float OldValue = Attr.Value;
+	// Nothing instance-specific yet (no modifiers or edits): share the asset's baked attribute set instead of copying
+	// it. Otherwise apply the baked entries on top of this instance's state. Re-initializing from data that leaves out
+	// an attribute the previous data set also applies on top, so that attribute keeps its value like it always did.
+	const TSharedRef<const FAttributeTemplate> Previous = Attributes.GetTemplate();
+	const bool bShareTemplate = !Attributes.HasOverlay() && (!bAttributesInitialized || Template->SetsEveryAttributeOf(*Previous));
+	if (bShareTemplate)
+	{
+		INC_DWORD_STAT(STAT_AttributeSharedInits);
+		Attributes.SetTemplate(Template);
 
-		Attr.BaseValue   = Entry.BaseValue;
-		Attr.NumericType = Entry.NumericType;
-		Attr.RoundingMode = Entry.RoundingMode;
-		Attr.ClampMode = Entry.ClampMode;
-		Attr.ClampValue = Entry.ClampValue;
-		if (Attr.NumericType == EAttributeNumericType::Integer)
+		// First initialization: nothing can have observed the old values, OnAttributeInitialized covers every attribute
+		if (!bAttributesInitialized)
 		{
-			Attr.BaseValue = static_cast<float>(FMath::RoundToInt(Attr.BaseValue));
-			if (Attr.ClampMode != EAttributeClampMode::None)
+			if (bEnableAttributeDebugLogging)
 			{
-				Attr.ClampValue = static_cast<float>(FMath::RoundToInt(Attr.ClampValue));
+				for (const int32 Index : Template->DataSlots)
+				{
+					Debug::Log(FString::Printf(TEXT("%s Attribute '%s' initialized: Base=%.2f, Value=%.2f"), *GetOwner()->GetName(), *Template->Tags[Index].ToString(), Template->BaseValues[Index], Template->Values[Index]), true, 2.f);
+				}
 			}
+			bAttributesInitialized = true;
+			OnAttributeInitialized.Broadcast();
+			return;
 		}
-		Attr.Recalculate();
+	}
+	else
+	{
+		INC_DWORD_STAT(STAT_AttributeCopiedInits);
+	}
 
-		const float NewBase = Attr.BaseValue;
-		const float NewValue = Attr.Value;
+	// Entries were validated, rounded and recalculated when the data was baked
+	for (const int32 TemplateIndex : Template->DataSlots)
+	{
+		const FGameplayTag& Tag = Template->Tags[TemplateIndex];
+		const int32 Index = Attributes.FindOrAddIndex(Tag);
 
-		if (!FMath::IsNearlyEqual(OldBase, NewBase))
+		float OldBase = 0.f;
+		float OldValue = 0.f;
+		if (bShareTemplate)
 		{
-			OnAttributeBaseChanged.Broadcast(Entry.AttributeTag, OldBase, NewBase);
+			const int32 PreviousIndex = Previous->FindIndex(Tag);
+			if (PreviousIndex != INDEX_NONE)
+			{
+				OldBase = Previous->BaseValues[PreviousIndex];
+				OldValue = Previous->Values[PreviousIndex];
+			}
 		}
-		if (!FMath::IsNearlyEqual(OldValue, NewValue))
+		else
 		{
-			OnAttributeValueChanged.Broadcast(Entry.AttributeTag, OldValue, NewValue);
-			OnAnyAttributeChanged.Broadcast(Entry.AttributeTag, OldValue, NewValue);
+			const FAttribute & Source = Template->Records[TemplateIndex];
+			FAttribute & Edit = Attributes.EditRecord(Index);
+			OldBase = Edit.BaseValue;
+			OldValue = Edit.Value;
+
+			Edit.BaseValue = Source.BaseValue;
+			Edit.NumericType = Source.NumericType;
+			Edit.RoundingMode = Source.RoundingMode;
+			Edit.ClampMode = Source.ClampMode;
+			Edit.ClampValue = Source.ClampValue;
+			Attributes.Recalculate(Index);
 		}
 
-		// Diagnostic: warn if clamp immediately forces value away from base (common cause of unexpected zeros)
-		if (Attr.ClampMode == EAttributeClampMode::Max && Attr.ClampValue < NewBase && FMath::IsNearlyEqual(NewValue, Attr.ClampValue))
+		const float NewBase = Attributes.GetBaseValue(Index);
+		const float NewValue = Attributes.GetValue(Index);
+
+		if (!FMath::IsNearlyEqual(OldBase, NewBase))
 		{
-			if (bEnableAttributeDebugLogging) Debug::LogWarning(FString::Printf(TEXT("Attribute '%s' was clamped by Max ClampValue %.2f (Base=%.2f). Result=%.2f"), *Entry.AttributeTag.ToString(), Attr.ClampValue, NewBase, NewValue), true, 100.f);
+			OnAttributeBaseChanged.Broadcast(Tag, OldBase, NewBase);
 		}
-		else if (Attr.ClampMode == EAttributeClampMode::Min && Attr.ClampValue > NewBase && FMath::IsNearlyEqual(NewValue, Attr.ClampValue))
+		if (!FMath::IsNearlyEqual(OldValue, NewValue))
 		{
-			if (bEnableAttributeDebugLogging) Debug::LogWarning(FString::Printf(TEXT("Attribute '%s' was raised by Min ClampValue %.2f (Base=%.2f). Result=%.2f"), *Entry.AttributeTag.ToString(), Attr.ClampValue, NewBase, NewValue), true, 100.f);
+			OnAttributeValueChanged.Broadcast(Tag, OldValue, NewValue);
+			OnAnyAttributeChanged.Broadcast(Tag, OldValue, NewValue);
 		}
 		if (bEnableAttributeDebugLogging)
 		{
-			Debug::Log(FString::Printf(TEXT("%s Attribute '%s' initialized: Base=%.2f, Value=%.2f"), *GetOwner()->GetName(), *Entry.AttributeTag.ToString(), NewBase, NewValue), true, 2.f);
+			Debug::Log(FString::Printf(TEXT("%s Attribute '%s' initialized: Base=%.2f, Value=%.2f"), *GetOwner()->GetName(), *Tag.ToString(), NewBase, NewValue), true, 2.f);
 		}
 	}
 	
@@ -687,7 +756,7 @@ void AddTagToConfig(const FString& TagName, const FString& Comment)
 }
 #endif
 
-FAttribute& UAttributeComponent::RegisterAndGetAttribute(const FString& TagName,
+FAttribute UAttributeComponent::RegisterAndGetAttribute(const FString& TagName,
                                                          const FString& DevComment /*= TEXT("")*/)
 {
 	// Tags must be declared ahead of time (native or config). Do not register at runtime.
@@ -704,7 +773,7 @@ FAttribute& UAttributeComponent::RegisterAndGetAttribute(const FString& TagName,
 #endif
 	}
 
-	return Attributes.FindOrAdd(Tag);
+	return Attributes.GetRecord(Attributes.FindOrAddIndex(Tag));
 }
 
 void UAttributeComponent::EnsureAttributesInitialized()
@@ -718,6 +787,56 @@ void UAttributeComponent::EnsureAttributesInitialized()
 
 	InitializeFromAgentData(AgentData);
 }
+
+void UAttributeComponent::CommitAttribute(int32 Index, float OldValue)
+{
+	RecalculateIndex(Index);
+	BroadcastValueChange(Index, OldValue);
+}
+
+void UAttributeComponent::RecalculateIndex(int32 Index)
+{
+	if (BatchDepth > 0)
+	{
+		// Base values stay readable mid-batch; the value itself is recalculated once at EndBatch
+		Attributes.Sync(Index);
+		if (Index >= BatchDirty.Num())
+		{
+			BatchDirty.Add(false, Index + 1 - BatchDirty.Num());
+		}
+		BatchDirty[Index] = true;
+		return;
+	}
+	Attributes.Recalculate(Index);
+}
+
+void UAttributeComponent::BroadcastValueChange(int32 Index, float OldValue)
+{
+	if (BatchDepth > 0)
+	{
+		// Keep the first old value so the coalesced event spans the whole batch
+		++BatchDeferredChanges;
+		if (Index >= BatchPending.Num())
+		{
+			BatchPending.Add(false, Index + 1 - BatchPending.Num());
+		}
+		if (!BatchPending[Index])
+		{
+			BatchPending[Index] = true;
+			BatchPendingIndices.Add(Index);
+			BatchPendingOldValues.Add(OldValue);
+		}
+		return;
+	}
+
+	const float NewValue = Attributes.GetValue(Index);
+	if (!FMath::IsNearlyEqual(OldValue, NewValue))
+	{
+		const FGameplayTag& Tag = Attributes.GetTag(Index);
+		OnAttributeValueChanged.Broadcast(Tag, OldValue, NewValue);
+		OnAnyAttributeChanged.Broadcast(Tag, OldValue, NewValue);
+	}
+}
 #pragma endregion InternalAPI
 
 // -- Rounding API --
@@ -741,39 +860,25 @@ EAttributeNumericType UAttributeComponent::GetAttributeNumericType(FGameplayTag
 
 void UAttributeComponent::SetAttributeNumericType(FGameplayTag Tag, EAttributeNumericType Type)
 {
-	if (FAttribute* Attribute = Attributes.Find(Tag))
+	const int32 Index = Attributes.FindIndex(Tag);
+	if (Index != INDEX_NONE && Attributes.GetRecord(Index).NumericType != Type)
 	{
-		if (Attribute->NumericType != Type)
-		{
-			const float OldValue = Attribute->Value;
-			Attribute->NumericType = Type;
-			Attribute->Recalculate();
-			const float NewValue = Attribute->Value;
-			if (!FMath::IsNearlyEqual(OldValue, NewValue))
-			{
-				OnAttributeValueChanged.Broadcast(Tag, OldValue, NewValue);
-				OnAnyAttributeChanged.Broadcast(Tag, OldValue, NewValue);
-			}
-		}
+		FAttribute& Attribute = Attributes.EditRecord(Index);
+		const float OldValue = Attribute.Value;
+		Attribute.NumericType = Type;
+		CommitAttribute(Index, OldValue);
 	}
 }
 
 void UAttributeComponent::SetAttributeRoundingMode(FGameplayTag Tag, EAttributeRoundingMode Mode)
 {
-	if (FAttribute* Attribute = Attributes.Find(Tag))
+	const int32 Index = Attributes.FindIndex(Tag);
+	if (Index != INDEX_NONE && Attributes.GetRecord(Index).RoundingMode != Mode)
 	{
-		if (Attribute->RoundingMode != Mode)
-		{
-			const float OldValue = Attribute->Value;
-			Attribute->RoundingMode = Mode;
-			Attribute->Recalculate();
-			const float NewValue = Attribute->Value;
-			if (!FMath::IsNearlyEqual(OldValue, NewValue))
-			{
-				OnAttributeValueChanged.Broadcast(Tag, OldValue, NewValue);
-				OnAnyAttributeChanged.Broadcast(Tag, OldValue, NewValue);
-			}
-		}
+		FAttribute& Attribute = Attributes.EditRecord(Index);
+		const float OldValue = Attribute.Value;
+		Attribute.RoundingMode = Mode;
+		CommitAttribute(Index, OldValue);
 	}
 }
 
@@ -906,13 +1011,24 @@ FAttributePreviewResult UAttributeComponent::PreviewApplyModifiersForTag(FGamepl
 	return Result;
 }
 
+#if WITH_EDITOR
+void UAttributeComponent::RefreshAttributeSnapshot()
+{
+	AttributeSnapshot = GetAttributes();
+}
+#endif
+
 void UAttributeComponent::DumpAttributes() const
 {
 	UE_LOG(LogTemp, Log, TEXT("=== AttributeComponent Dump (%s) ==="), *GetOwner()->GetName());
-	for (const auto& KVP : Attributes)
+	for (int32 Index = 0; Index < Attributes.Num(); ++Index)
 	{
-		const FGameplayTag& Tag = KVP.Key;
-		const FAttribute& Attr = KVP.Value;
+		if (!Attributes.IsRegistered(Index))
+		{
+			continue;
+		}
+		const FGameplayTag& Tag = Attributes.GetTag(Index);
+		const FAttribute& Attr = Attributes.GetRecord(Index);
 		FString NumericTypeStr = Attr.NumericType == EAttributeNumericType::Integer ? TEXT("Integer") : TEXT("Float");
 		FString ClampModeStr = TEXT("None");
 		switch (Attr.ClampMode)
@@ -0,0 +1,229 @@
+﻿#include "Systems/AttributeSystem/AttributeStore.h"
+
+// -- FAttributeTemplate --
+
+FAttributeTemplate::FAttributeTemplate()
+{
+	constexpr int32 NumNative = static_cast<int32>(EAttributeId::NumNative);
+	Values.Init(0.f, NumNative);
+	BaseValues.Init(0.f, NumNative);
+	Flags.Init(Flag_Registered, NumNative);
+	Records.SetNum(NumNative);
+	Tags.Reserve(NumNative);
+	for (int32 Index = 0; Index < NumNative; ++Index)
+	{
+		Tags.Add(AttributeTags::GetNativeTag(static_cast<EAttributeId>(Index)));
+	}
+}
+
+int32 FAttributeTemplate::FindIndex(const FGameplayTag& Tag) const
+{
+	const int32 NativeIndex = AttributeTags::FindNativeIndex(Tag);
+	if (NativeIndex != INDEX_NONE)
+	{
+		return NativeIndex;
+	}
+	const int32* Found = ExtraIndices.Find(Tag);
+	return Found ? *Found : INDEX_NONE;
+}
+
+bool FAttributeTemplate::SetsEveryAttributeOf(const FAttributeTemplate& Other) const
+{
+	for (const int32 OtherSlot : Other.DataSlots)
+	{
+		const int32 Slot = FindIndex(Other.Tags[OtherSlot]);
+		if (Slot == INDEX_NONE || !DataSlots.Contains(Slot)) return false;
+	}
+	return true;
+}
+
+int32 FAttributeTemplate::FindOrAddSlot(const FGameplayTag& Tag)
+{
+	const int32 Existing = FindIndex(Tag);
+	if (Existing != INDEX_NONE)
+	{
+		return Existing;
+	}
+	Values.Add(0.f);
+	BaseValues.Add(0.f);
+	Flags.Add(Flag_Registered);
+	Tags.Add(Tag);
+	const int32 Index = Records.AddDefaulted();
+	ExtraIndices.Add(Tag, Index);
+	return Index;
+}
+
+TSharedRef<const FAttributeTemplate> FAttributeTemplate::GetEmpty()
+{
+	static const TSharedRef<const FAttributeTemplate> Empty = MakeShareable(new FAttributeTemplate());
+	return Empty;
+}
+
+TSharedRef<const FAttributeTemplate> FAttributeTemplate::Build(TConstArrayView<FAgentAttributeBaked> Entries)
+{
+	FAttributeTemplate* Baked = new FAttributeTemplate();
+	Baked->DataSlots.Reserve(Entries.Num());
+	for (const FAgentAttributeBaked& Entry : Entries)
+	{
+		const int32 Index = Entry.NativeIndex != INDEX_NONE ? Entry.NativeIndex : Baked->FindOrAddSlot(Entry.AttributeTag);
+		FAttribute& Attr = Baked->Records[Index];
+		Attr.BaseValue = Entry.BaseValue;
+		Attr.Value = Entry.Value;
+		Attr.NumericType = Entry.NumericType;
+		Attr.RoundingMode = Entry.RoundingMode;
+		Attr.ClampMode = Entry.ClampMode;
+		Attr.ClampValue = Entry.ClampValue;
+
+		Baked->Values[Index] = Entry.Value;
+		Baked->BaseValues[Index] = Entry.BaseValue;
+		Baked->Flags[Index] = MakeFlags(Attr);
+		Baked->DataSlots.Add(Index);
+	}
+	return MakeShareable(Baked);
+}
+
+uint8 FAttributeTemplate::MakeFlags(const FAttribute& Record)
+{
+	return Flag_Registered | (Record.NumericType == EAttributeNumericType::Integer ? Flag_Integer : 0);
+}
+
+// -- FAttributeStore --
+
+FAttributeStore::FAttributeStore()
+	: Template(FAttributeTemplate::GetEmpty())
+{
+	RefreshDataPointers();
+}
+
+void FAttributeStore::SetTemplate(const TSharedRef<const FAttributeTemplate>& InTemplate)
+{
+	Template = InTemplate;
+	bOwnsHotData = false;
+	Values.Empty();
+	BaseValues.Empty();
+	Flags.Empty();
+	OverlayRecords.Empty();
+	ExtraTags.Empty();
+	ExtraIndices.Empty();
+	RefreshDataPointers();
+}
+
+SIZE_T FAttributeStore::GetOverlayAllocatedSize() const
+{
+	SIZE_T Size = Values.GetAllocatedSize() + BaseValues.GetAllocatedSize() + Flags.GetAllocatedSize()
+		+ OverlayRecords.GetAllocatedSize() + ExtraTags.GetAllocatedSize() + ExtraIndices.GetAllocatedSize();
+	for (const TPair<int32, FAttribute>& Pair : OverlayRecords)
+	{
+		Size += Pair.Value.ActiveModifiers.GetAllocatedSize();
+	}
+	return Size;
+}
+
+int32 FAttributeStore::FindIndex(const FGameplayTag& Tag) const
+{
+	const int32 Index = Template->FindIndex(Tag);
+	if (Index != INDEX_NONE)
+	{
+		return Index;
+	}
+	const int32* Found = ExtraIndices.Find(Tag);
+	return Found ? *Found : INDEX_NONE;
+}
+
+int32 FAttributeStore::FindOrAddIndex(const FGameplayTag& Tag)
+{
+	const int32 Existing = FindIndex(Tag);
+	if (Existing != INDEX_NONE)
+	{
+		return Existing;
+	}
+
+	MakeHotDataUnique();
+	const int32 Index = NumSlots;
+	Values.Add(0.f);
+	BaseValues.Add(0.f);
+	Flags.Add(FAttributeTemplate::Flag_Registered);
+	ExtraTags.Add(Tag);
+	ExtraIndices.Add(Tag, Index);
+	OverlayRecords.Add(Index);
+	RefreshDataPointers();
+	return Index;
+}
+
+const FGameplayTag& FAttributeStore::GetTag(int32 Index) const
+{
+	return Index < Template->Num() ? Template->Tags[Index] : ExtraTags[Index - Template->Num()];
+}
+
+const FAttribute& FAttributeStore::GetRecord(int32 Index) const
+{
+	if (const FAttribute* Own = OverlayRecords.Find(Index))
+	{
+		return *Own;
+	}
+	return Template->Records[Index];
+}
+
+FAttribute& FAttributeStore::EditRecord(int32 Index)
+{
+	if (FAttribute* Own = OverlayRecords.Find(Index))
+	{
+		return *Own;
+	}
+	return OverlayRecords.Add(Index, Template->Records[Index]);
+}
+
+const FAttribute* FAttributeStore::Find(const FGameplayTag& Tag) const
+{
+	const int32 Index = FindIndex(Tag);
+	return Index != INDEX_NONE ? &GetRecord(Index) : nullptr;
+}
+
+void FAttributeStore::Sync(int32 Index)
+{
+	MakeHotDataUnique();
+	const FAttribute& Record = GetRecord(Index);
+	Values[Index] = Record.Value;
+	BaseValues[Index] = Record.BaseValue;
+	Flags[Index] = FAttributeTemplate::MakeFlags(Record);
+}
+
+void FAttributeStore::Recalculate(int32 Index)
+{
+	if (FAttribute* Own = OverlayRecords.Find(Index))
+	{
+		Own->Recalculate();
+		Sync(Index);
+	}
+}
+
+void FAttributeStore::MakeHotDataUnique()
+{
+	if (bOwnsHotData)
+	{
+		return;
+	}
+	bOwnsHotData = true;
+	Values = Template->Values;
+	BaseValues = Template->BaseValues;
+	Flags = Template->Flags;
+	RefreshDataPointers();
+}
+
+void FAttributeStore::RefreshDataPointers()
+{
+	if (bOwnsHotData)
+	{
+		ValueData = Values.GetData();
+		BaseData = BaseValues.GetData();
+		FlagData = Flags.GetData();
+		NumSlots = Values.Num();
+	}
+	else
+	{
+		ValueData = Template->Values.GetData();
+		BaseData = Template->BaseValues.GetData();
+		FlagData = Template->Flags.GetData();
+		NumSlots = Template->Num();
+	}
+}
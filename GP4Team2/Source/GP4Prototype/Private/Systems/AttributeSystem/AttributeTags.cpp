@@ -1,5 +1,6 @@
 ﻿#include "Systems/AttributeSystem/AttributeTags.h"
 #include "GameplayTagsManager.h"
+#include <atomic>
 
 // Define native gameplay tags. These are loaded at startup in cooked builds.
 namespace AttributeTags
@@ -90,4 +91,86 @@ namespace AttributeTags
 		}
 		return FGameplayTag();
 	}
+
+	// Indexed by EAttributeId
+	static const FNativeGameplayTag* const NativeTable[] = {
+		&Attribute_MaxHealth,
+		&Attribute_MaxDefense,
+		&Attribute_Dash_Cooldown,
+		&Attribute_Dash_CooldownPerCharge,
+		&Attribute_Dash_KnockbackForce,
+		&Attribute_Dash_KnockbackForceDead,
+		&Attribute_Dash_Strength,
+		&Attribute_Dash_MaxCharges,
+		&Attribute_Dash_CollisionDamage,
+		&Attribute_Killstreak_ExplosiveRounds,
+		&Attribute_Movement_WalkSpeed,
+		&Attribute_Movement_SprintSpeed,
+		&Attribute_Movement_CrouchSpeed,
+		&Attribute_Melee_Damage,
+		&Attribute_Melee_KnockbackForce,
+		&Attribute_Melee_KnockbackForceDead,
+		&Attribute_Melee_Cooldown,
+		&Attribute_Melee_HitDetection,
+		&Attribute_Melee_HitDetectionRadius,
+		&Attribute_Melee_SwingAmount,
+		&Attribute_Slide_Strength,
+		&Attribute_Slide_Duration,
+		&Attribute_Slide_Cooldown,
+		&Attribute_Slide_CollisionDamage,
+		&Attribute_Slide_ScopeTimeDilation,
+		&Attribute_SlowMo_TimeDilation,
+		&Attribute_SlowMo_MaxDuration,
+		&Attribute_SlowMo_Cooldown,
+		&Attribute_Throw_Force,
+		&Attribute_Throw_Damage,
+		&Attribute_Weapon_FireDelay,
+		&Attribute_Weapon_ReloadSpeed,
+		&Attribute_Weapon_Damage,
+	};
+	static_assert(UE_ARRAY_COUNT(NativeTable) == static_cast<int32>(EAttributeId::NumNative), "NativeTable must match EAttributeId");
+
+	FGameplayTag GetNativeTag(EAttributeId Id)
+	{
+		check(Id < EAttributeId::NumNative);
+		return NativeTable[static_cast<int32>(Id)]->GetTag();
+	}
+
+	int32 FindNativeIndex(const FGameplayTag& Tag)
+	{
+		if (!Tag.IsValid()) return INDEX_NONE;
+
+		// The map below is built exactly once, so it must not be built while a native tag is still unset (a lookup
+		// during static initialization); until every tag is set, scan the table instead
+		static std::atomic<bool> bNativeTagsSet = false;
+		if (!bNativeTagsSet.load(std::memory_order_acquire))
+		{
+			bool bAllSet = true;
+			for (int32 Index = 0; Index < UE_ARRAY_COUNT(NativeTable); ++Index)
+			{
+				const FGameplayTag NativeTag = NativeTable[Index]->GetTag();
+				if (NativeTag == Tag) return Index;
+				bAllSet &= NativeTag.IsValid();
+			}
+			if (!bAllSet) return INDEX_NONE;
+			bNativeTagsSet.store(true, std::memory_order_release);
+		}
+
+		static const TMap<FGameplayTag, int32> TagToIndex = []
+		{
+			TMap<FGameplayTag, int32> Map;
+			Map.Reserve(UE_ARRAY_COUNT(NativeTable));
+			for (int32 Index = 0; Index < UE_ARRAY_COUNT(NativeTable); ++Index)
+			{
+				Map.Add(NativeTable[Index]->GetTag(), Index);
+			}
+			return Map;
+		}();
+
+		if (const int32* Found = TagToIndex.Find(Tag))
+		{
+			return *Found;
+		}
+		return INDEX_NONE;
+	}
 }
@@ -20,10 +20,10 @@ void UAbilitySlowMo::Init_Implementation(UAbilityComponent* _MyAbilityComponent)
 	}
 
 	float TimeDilDuration = FallbackTimeDilationDuration;
-	if (AttributeComponent) TimeDilDuration = AttributeComponent->GetAttributeValue(AttributeTags::Attribute_SlowMo_MaxDuration);
+	if (AttributeComponent) TimeDilDuration = AttributeComponent->GetAttributeValue(EAttributeId::SlowMo_MaxDuration);
 
 	float TimeDilStrength = FallbackTimeDilationStrength;
-	if (AttributeComponent) TimeDilStrength = AttributeComponent->GetAttributeValue(AttributeTags::Attribute_SlowMo_TimeDilation);
+	if (AttributeComponent) TimeDilStrength = AttributeComponent->GetAttributeValue(EAttributeId::SlowMo_TimeDilation);
 	
 	AbilityDuration = TimeDilStrength * TimeDilDuration;
 }
@@ -31,16 +31,16 @@ void UAbilitySlowMo::Init_Implementation(UAbilityComponent* _MyAbilityComponent)
 bool UAbilitySlowMo::StartUsing()
 {
 	float TimeDilDuration = FallbackTimeDilationDuration;
-	if (AttributeComponent) TimeDilDuration = AttributeComponent->GetAttributeValue(AttributeTags::Attribute_SlowMo_MaxDuration);
+	if (AttributeComponent) TimeDilDuration = AttributeComponent->GetAttributeValue(EAttributeId::SlowMo_MaxDuration);
 
 	float TimeDilStrength = FallbackTimeDilationStrength;
-	if (AttributeComponent) TimeDilStrength = AttributeComponent->GetAttributeValue(AttributeTags::Attribute_SlowMo_TimeDilation);
+	if (AttributeComponent) TimeDilStrength = AttributeComponent->GetAttributeValue(EAttributeId::SlowMo_TimeDilation);
 	
 	AbilityDuration = TimeDilStrength * TimeDilDuration;
 
 	
 	float SlowMoCooldown = FallbackSlowMoCooldown;
-	if (AttributeComponent) SlowMoCooldown = AttributeComponent->GetAttributeValue(AttributeTags::Attribute_SlowMo_Cooldown);
+	if (AttributeComponent) SlowMoCooldown = AttributeComponent->GetAttributeValue(EAttributeId::SlowMo_Cooldown);
 	
 	AbilityCooldown = SlowMoCooldown;
 	
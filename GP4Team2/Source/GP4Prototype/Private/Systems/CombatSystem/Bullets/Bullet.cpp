@@ -1,17 +1,21 @@
 #include "Systems/CombatSystem/Bullets/Bullet.h"
 
 #include "Components/CapsuleComponent.h"
+#include "NiagaraFunctionLibrary.h"
 #include "Core/Data/Enums/GameDamageType.h"
 #include "Core/Data/Interfaces/Damageable.h"
 #include "Systems/CombatSystem/CombatEventsSubsystem.h"
 #include "Systems/CombatSystem/Components/WeakPoint.h"
 #include "Systems/CombatSystem/Components/WeakPointComponent.h"
-#include "ObjectPool/ObjectPoolSubsystem.h"
+#include "ObjectPool/PooledActorComponent.h"
+#include "Systems/CombatSystem/Bullets/ProjectileUpdateSubsystem.h"
 
 
 ABullet::ABullet()
 {
 	PrimaryActorTick.bCanEverTick = true;
+	// Ticking is switched on in Init only when the batched projectile update is off
+	PrimaryActorTick.bStartWithTickEnabled = false;
 
 	StaticMesh = CreateDefaultSubobject<UStaticMeshComponent>(TEXT("StaticMesh"));
 	StaticMesh->SetupAttachment(RootComponent);
@@ -25,7 +29,29 @@ void ABullet::BeginPlay()
 	// Bind overlap once; pooled reuse won't duplicate bindings
 	if (StaticMesh)
 	{
-		StaticMesh->OnComponentBeginOverlap.AddDynamic(this, &ABullet::BulletHit);
+		// Sweeping bullets find their own hits, overlap generation would only cost a query per move
+		if (UsesSweepHitDetection()) StaticMesh->SetGenerateOverlapEvents(false);
+		else StaticMesh->OnComponentBeginOverlap.AddDynamic(this, &ABullet::BulletHit);
+	}
+}
+
+void ABullet::SetHitDetection(EBulletHitDetection InHitDetection)
+{
+	if (HitDetection == InHitDetection) return;
+	HitDetection = InHitDetection;
+
+	// Before BeginPlay there is nothing wired yet
+	if (!HasActorBegunPlay() || !StaticMesh) return;
+
+	if (UsesSweepHitDetection())
+	{
+		StaticMesh->OnComponentBeginOverlap.RemoveDynamic(this, &ABullet::BulletHit);
+		StaticMesh->SetGenerateOverlapEvents(false);
+	}
+	else
+	{
+		StaticMesh->SetGenerateOverlapEvents(true);
+		StaticMesh->OnComponentBeginOverlap.AddUniqueDynamic(this, &ABullet::BulletHit);
 	}
 }
 
@@ -37,10 +63,40 @@ void ABullet::Init(UCombatEventsSubsystem* InCombatEventsSubsystem, float Damage
 	BaseMoveSpeed = MoveSpeed * BulletSpecificSpeedMultiplier;
 
 	MoveComp->MaxSpeed = MoveSpeed * BulletSpecificSpeedMultiplier;
+	MoveComp->Velocity = GetActorForwardVector() * BaseMoveSpeed;
+
+	UProjectileUpdateSubsystem* ProjectileUpdate = GetWorld() ? GetWorld()->GetSubsystem<UProjectileUpdateSubsystem>() : nullptr;
+	if (ProjectileUpdate && UProjectileUpdateSubsystem::IsBatchingEnabled())
+	{
+		// The subsystem moves us; neither our tick nor the movement component's is needed
+		SetActorTickEnabled(false);
+		MoveComp->SetComponentTickEnabled(false);
+		ProjectileUpdate->RegisterBullet(this, BaseMoveSpeed);
+	}
+	else
+	{
+		// Sweeping bullets move themselves in Tick so every step is swept
+		StopBatchedUpdate();
+		SetActorTickEnabled(true);
+		MoveComp->SetComponentTickEnabled(!UsesSweepHitDetection());
+	}
+}
+
+void ABullet::StopBatchedUpdate()
+{
+	if (ProjectileUpdateIndex == INDEX_NONE) return;
+
+	if (UProjectileUpdateSubsystem* ProjectileUpdate = GetWorld() ? GetWorld()->GetSubsystem<UProjectileUpdateSubsystem>() : nullptr)
+	{
+		ProjectileUpdate->UnregisterBullet(this);
+	}
+	ProjectileUpdateIndex = INDEX_NONE;
 }
 
 void ABullet::EndPlay(const EEndPlayReason::Type EndPlayReason)
 {
+	StopBatchedUpdate();
+
 	if (StaticMesh)
 	{
 		StaticMesh->OnComponentBeginOverlap.RemoveDynamic(this, &ABullet::BulletHit);
@@ -49,49 +105,102 @@ void ABullet::EndPlay(const EEndPlayReason::Type EndPlayReason)
 	Super::EndPlay(EndPlayReason);
 }
 
+void ABullet::OnReleased_Implementation()
+{
+	// Drop per-shot state so the next Init starts clean
+	StopBatchedUpdate();
+	CombatEventsSubsystem = nullptr;
+	BaseDamage = 0.f;
+	BaseMoveSpeed = 0.f;
+}
+
 void ABullet::Tick(float DeltaTime)
 {
 	Super::Tick(DeltaTime);
 
+	if (UsesSweepHitDetection())
+	{
+		const FVector Start = GetActorLocation();
+		const FVector End = Start + GetActorForwardVector() * BaseMoveSpeed * DeltaTime;
+
+		FHitResult Hit;
+		if (SweepForHit(Start, End, Hit))
+		{
+			SetActorLocation(Hit.Location);
+			HandleSweepHit(Hit);
+			return;
+		}
+		SetActorLocation(End);
+		return;
+	}
+
 	MoveComp->Velocity = GetActorForwardVector() * BaseMoveSpeed;
 }
 
+bool ABullet::SweepForHit(const FVector& Start, const FVector& End, FHitResult& OutHit) const
+{
+	UWorld* World = GetWorld();
+	if (!World) return false;
+
+	FCollisionQueryParams Params(SCENE_QUERY_STAT(BulletSweep), false, this);
+	if (AActor* BulletInstigator = GetInstigator()) Params.AddIgnoredActor(BulletInstigator);
+
+	return World->SweepSingleByChannel(OutHit, Start, End, FQuat::Identity, SweepChannel,
+		FCollisionShape::MakeSphere(SweepRadius), Params) && OutHit.GetActor();
+}
+
+void ABullet::HandleSweepHit(const FHitResult& Hit)
+{
+	BulletHit(StaticMesh, Hit.GetActor(), Hit.GetComponent(), Hit.Item, true, Hit);
+}
+
+FName ABullet::ApplyHitDamage(AActor* OtherActor, UPrimitiveComponent* OtherComp, const FHitResult& Hit, float Damage)
+{
+	FName HitSocketName = "";
+	if (!OtherActor || !OtherActor->GetClass()->ImplementsInterface(UDamageable::StaticClass())) return HitSocketName;
+
+	if (USkeletalMeshComponent* Skeletal = Cast<USkeletalMeshComponent>(OtherComp))
+	{
+		if (IsValid(Skeletal)) HitSocketName = Hit.BoneName;
+	}
+	else if (UWeakPoint* WeakPointCapsule = Cast<UWeakPoint>(OtherComp))
+	{
+		HitSocketName = WeakPointCapsule->GetBoneAttachedTo();
+	}
+
+	IDamageable::Execute_TakeDamage(OtherActor, EGameDamageType::Gun, Damage, 1.0f, HitSocketName);
+	return HitSocketName;
+}
+
+void ABullet::SpawnImpactEffect(const UObject* WorldContextObject, const FVector& Location, const FRotator& Rotation) const
+{
+	if (!ImpactEffect || !WorldContextObject) return;
+
+	UNiagaraFunctionLibrary::SpawnSystemAtLocation(WorldContextObject, ImpactEffect, Location, Rotation,
+		FVector::OneVector, true, true, ENCPoolMethod::AutoRelease);
+}
+
 void ABullet::BulletHit(UPrimitiveComponent* OverlappedComp, AActor* OtherActor, UPrimitiveComponent* OtherComp, int32 OtherBodyIndex, bool bFromSweep, const FHitResult& SweepResult)
 {
 	if (!OtherActor) return;
 	if (OtherActor == this) return;
 	if (OtherActor == GetInstigator()) return;
 
-	FName HitSocketName = "";
-	if (OtherActor->GetClass()->ImplementsInterface(UDamageable::StaticClass()))
-	{
-		if (USkeletalMeshComponent* Skeletal = Cast<USkeletalMeshComponent>(OtherComp))
-		{
-			if (IsValid(Skeletal)) HitSocketName = SweepResult.BoneName;
-		}
-		else if (UWeakPoint* WeakPointCapsule = Cast<UWeakPoint>(OtherComp))
-		{
-			HitSocketName = WeakPointCapsule->GetBoneAttachedTo();
-		}
-
-		IDamageable::Execute_TakeDamage(OtherActor, EGameDamageType::Gun, BaseDamage, 1.0f, HitSocketName);
-	}
+	const FName HitSocketName = ApplyHitDamage(OtherActor, OtherComp, SweepResult, BaseDamage);
 
 	OnHit.Broadcast(OtherActor, BaseDamage, HitSocketName, OverlappedComp, OtherComp, OtherBodyIndex, bFromSweep, SweepResult);
+
+	// Overlaps without a sweep carry no impact point, fall back to where the bullet is
+	const FVector ImpactLocation = bFromSweep ? FVector(SweepResult.ImpactPoint) : GetActorLocation();
+	const FRotator ImpactRotation = bFromSweep ? SweepResult.ImpactNormal.Rotation() : (-GetActorForwardVector()).Rotation();
+	SpawnImpactEffect(this, ImpactLocation, ImpactRotation);
 	
-	// Return to pool if available; otherwise destroy
-	if (UGameInstance* GI = GetWorld() ? GetWorld()->GetGameInstance() : nullptr)
+	// Return to pool through the back-reference; bullets spawned outside a pool are destroyed
+	if (PooledComponent && PooledComponent->GetOwningPool())
 	{
-		if (UObjectPoolSubsystem* Pool = GI->GetSubsystem<UObjectPoolSubsystem>())
-		{
-			Pool->ReleaseActor(this);
-			// If no pool existed for this actor class, ReleaseActor is a no-op. Fallback to Destroy.
-			if (IsActorTickEnabled())
-			{
-				Destroy();
-			}
-			return;
-		}
+		// A second hit in the same frame finds the bullet already free; it stays dormant in the pool
+		PooledComponent->ReleaseToPool();
+		return;
 	}
 
 	Destroy();
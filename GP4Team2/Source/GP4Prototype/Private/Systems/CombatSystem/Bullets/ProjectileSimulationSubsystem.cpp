@@ -0,0 +1,247 @@
+#include "Systems/CombatSystem/Bullets/ProjectileSimulationSubsystem.h"
+
+#include "Components/InstancedStaticMeshComponent.h"
+#include "Engine/World.h"
+
+DECLARE_CYCLE_STAT(TEXT("Projectile Simulation"), STAT_ProjectileSimulation, STATGROUP_Game);
+DECLARE_CYCLE_STAT(TEXT("Projectile Hit Resolve"), STAT_ProjectileHitResolve, STATGROUP_Game);
+DECLARE_CYCLE_STAT(TEXT("Projectile Instance Update"), STAT_ProjectileInstanceUpdate, STATGROUP_Game);
+
+void UProjectileSimulationSubsystem::Deinitialize()
+{
+	ClearProjectiles();
+	Groups.Empty();
+	RenderActor = nullptr;
+
+	Super::Deinitialize();
+}
+
+void UProjectileSimulationSubsystem::SpawnProjectile(const FProjectileSpawnParams& Params)
+{
+	if (!Params.BulletClass || Params.Speed <= 0.f) return;
+
+	const int32 GroupIndex = FindOrAddGroup(Params.BulletClass);
+	if (GroupIndex == INDEX_NONE) return;
+
+	FSimulatedProjectile& Projectile = Groups[GroupIndex].Projectiles.AddDefaulted_GetRef();
+	Projectile.Location = Params.Origin;
+	Projectile.Velocity = Params.Direction.GetSafeNormal() * Params.Speed;
+	Projectile.Damage = Params.Damage;
+	Projectile.Radius = Params.Radius;
+	Projectile.RemainingLifetime = Params.Lifetime;
+	Projectile.TraceChannel = Params.TraceChannel;
+	Projectile.Owner = Params.Owner;
+	Projectile.Instigator = Params.Instigator;
+	++NumLiveProjectiles;
+}
+
+void UProjectileSimulationSubsystem::ClearProjectiles()
+{
+	for (FProjectileGroup& Group : Groups)
+	{
+		Group.Projectiles.Reset();
+		UpdateGroupInstances(Group);
+	}
+	PendingHits.Reset();
+	NumLiveProjectiles = 0;
+}
+
+void UProjectileSimulationSubsystem::Tick(float DeltaTime)
+{
+	Super::Tick(DeltaTime);
+
+	{
+		SCOPE_CYCLE_COUNTER(STAT_ProjectileSimulation);
+		for (int32 GroupIndex = 0; GroupIndex < Groups.Num(); ++GroupIndex)
+		{
+			SimulateGroup(Groups[GroupIndex], GroupIndex, DeltaTime);
+		}
+	}
+
+	ResolvePendingHits();
+
+	SCOPE_CYCLE_COUNTER(STAT_ProjectileInstanceUpdate);
+	int32 Live = 0;
+	for (FProjectileGroup& Group : Groups)
+	{
+		UpdateGroupInstances(Group);
+		Live += Group.Projectiles.Num();
+	}
+	NumLiveProjectiles = Live;
+}
+
+void UProjectileSimulationSubsystem::SimulateGroup(FProjectileGroup& Group, int32 GroupIndex, float DeltaTime)
+{
+	UWorld* World = GetWorld();
+	if (!World) return;
+
+	// Most rounds in a group come from the same shooter, so the ignore list is only rebuilt when that changes
+	FCollisionQueryParams QueryParams(SCENE_QUERY_STAT(ProjectileSweep), false);
+	const AActor* ParamsOwner = nullptr;
+	const AActor* ParamsInstigator = nullptr;
+	bool bParamsBuilt = false;
+
+	TArray<FSimulatedProjectile>& Projectiles = Group.Projectiles;
+	for (int32 Index = Projectiles.Num() - 1; Index >= 0; --Index)
+	{
+		FSimulatedProjectile& Projectile = Projectiles[Index];
+
+		Projectile.RemainingLifetime -= DeltaTime;
+		if (Projectile.RemainingLifetime <= 0.f)
+		{
+			Projectiles.RemoveAtSwap(Index, EAllowShrinking::No);
+			continue;
+		}
+
+		const AActor* Owner = Projectile.Owner.Get();
+		const AActor* Instigator = Projectile.Instigator.Get();
+		if (!bParamsBuilt || Owner != ParamsOwner || Instigator != ParamsInstigator)
+		{
+			QueryParams.ClearIgnoredSourceObjects();
+			if (Owner) QueryParams.AddIgnoredActor(Owner);
+			if (Instigator) QueryParams.AddIgnoredActor(Instigator);
+			ParamsOwner = Owner;
+			ParamsInstigator = Instigator;
+			bParamsBuilt = true;
+		}
+
+		const FVector Start = Projectile.Location;
+		const FVector End = Start + Projectile.Velocity * DeltaTime;
+
+		FHitResult Hit;
+		const bool bHit = World->SweepSingleByChannel(Hit, Start, End, FQuat::Identity, Projectile.TraceChannel,
+			FCollisionShape::MakeSphere(Projectile.Radius), QueryParams);
+
+		if (bHit && Hit.GetActor())
+		{
+			FPendingHit& Pending = PendingHits.AddDefaulted_GetRef();
+			Pending.Hit = MoveTemp(Hit);
+			Pending.Damage = Projectile.Damage;
+			Pending.GroupIndex = GroupIndex;
+			Projectiles.RemoveAtSwap(Index, EAllowShrinking::No);
+			continue;
+		}
+
+		Projectile.Location = End;
+	}
+}
+
+void UProjectileSimulationSubsystem::ResolvePendingHits()
+{
+	if (PendingHits.Num() == 0) return;
+
+	SCOPE_CYCLE_COUNTER(STAT_ProjectileHitResolve);
+
+	// Damage can kill and end the floor (ClearProjectiles), so resolve from a local array
+	TArray<FPendingHit> Hits = MoveTemp(PendingHits);
+	PendingHits.Reset();
+
+	for (const FPendingHit& Pending : Hits)
+	{
+		AActor* OtherActor = Pending.Hit.GetActor();
+		if (!IsValid(OtherActor)) continue;
+
+		UPrimitiveComponent* OtherComp = Pending.Hit.GetComponent();
+		const FName HitSocketName = ABullet::ApplyHitDamage(OtherActor, OtherComp, Pending.Hit, Pending.Damage);
+
+		OnProjectileHit.Broadcast(OtherActor, Pending.Damage, HitSocketName, nullptr, OtherComp, Pending.Hit.Item, true, Pending.Hit);
+
+		if (Groups.IsValidIndex(Pending.GroupIndex))
+		{
+			if (const ABullet* BulletDefaults = GetDefault<ABullet>(Groups[Pending.GroupIndex].BulletClass))
+			{
+				BulletDefaults->SpawnImpactEffect(this, Pending.Hit.ImpactPoint, Pending.Hit.ImpactNormal.Rotation());
+			}
+		}
+	}
+
+	// Hand the grown buffer back for the next frame
+	PendingHits = MoveTemp(Hits);
+	PendingHits.Reset();
+}
+
+void UProjectileSimulationSubsystem::UpdateGroupInstances(FProjectileGroup& Group)
+{
+	UInstancedStaticMeshComponent* Mesh = Group.Mesh;
+	if (!IsValid(Mesh)) return;
+
+	const int32 Count = Group.Projectiles.Num();
+	InstanceScratch.Reset(Count);
+	for (const FSimulatedProjectile& Projectile : Group.Projectiles)
+	{
+		InstanceScratch.Add(Group.MeshRelativeTransform * FTransform(Projectile.Velocity.Rotation(), Projectile.Location));
+	}
+
+	// Instances only ever change at the tail, so nothing is reindexed
+	int32 Instances = Mesh->GetInstanceCount();
+	while (Instances > Count)
+	{
+		Mesh->RemoveInstance(--Instances);
+	}
+	if (Instances < Count)
+	{
+		Mesh->AddInstances(TArray<FTransform>(InstanceScratch.GetData() + Instances, Count - Instances), false, true);
+	}
+
+	if (Count > 0)
+	{
+		Mesh->BatchUpdateInstancesTransforms(0, InstanceScratch, true, true, true);
+	}
+}
+
+int32 UProjectileSimulationSubsystem::FindOrAddGroup(TSubclassOf<ABullet> BulletClass)
+{
+	for (int32 i = 0; i < Groups.Num(); ++i)
+	{
+		if (Groups[i].BulletClass == BulletClass) return i;
+	}
+
+	const ABullet* BulletDefaults = GetDefault<ABullet>(BulletClass);
+	if (!BulletDefaults) return INDEX_NONE;
+
+	FProjectileGroup& Group = Groups.AddDefaulted_GetRef();
+	Group.BulletClass = BulletClass;
+
+	const UStaticMeshComponent* DefaultMesh = BulletDefaults->GetBulletMesh();
+	if (DefaultMesh && DefaultMesh->GetStaticMesh())
+	{
+		EnsureRenderActor();
+		if (RenderActor)
+		{
+			UInstancedStaticMeshComponent* Mesh = NewObject<UInstancedStaticMeshComponent>(RenderActor);
+			Mesh->SetStaticMesh(DefaultMesh->GetStaticMesh());
+			for (int32 Slot = 0; Slot < DefaultMesh->GetNumMaterials(); ++Slot)
+			{
+				Mesh->SetMaterial(Slot, DefaultMesh->GetMaterial(Slot));
+			}
+			Mesh->SetCollisionEnabled(ECollisionEnabled::NoCollision);
+			Mesh->SetCastShadow(false);
+			Mesh->SetMobility(EComponentMobility::Movable);
+			Mesh->SetupAttachment(RenderActor->GetRootComponent());
+			Mesh->RegisterComponent();
+
+			Group.Mesh = Mesh;
+			Group.MeshRelativeTransform = DefaultMesh->GetRelativeTransform();
+		}
+	}
+
+	return Groups.Num() - 1;
+}
+
+void UProjectileSimulationSubsystem::EnsureRenderActor()
+{
+	if (RenderActor) return;
+
+	UWorld* World = GetWorld();
+	if (!World) return;
+
+	FActorSpawnParameters SpawnParams;
+	SpawnParams.ObjectFlags |= RF_Transient;
+	SpawnParams.SpawnCollisionHandlingOverride = ESpawnActorCollisionHandlingMethod::AlwaysSpawn;
+	RenderActor = World->SpawnActor<AActor>(AActor::StaticClass(), FTransform::Identity, SpawnParams);
+	if (!RenderActor) return;
+
+	USceneComponent* Root = NewObject<USceneComponent>(RenderActor, TEXT("Root"));
+	RenderActor->SetRootComponent(Root);
+	Root->RegisterComponent();
+}
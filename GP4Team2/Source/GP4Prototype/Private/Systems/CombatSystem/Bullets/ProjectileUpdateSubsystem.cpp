@@ -0,0 +1,170 @@
+#include "Systems/CombatSystem/Bullets/ProjectileUpdateSubsystem.h"
+
+#include "Async/ParallelFor.h"
+#include "HAL/IConsoleManager.h"
+#include "Systems/CombatSystem/Bullets/Bullet.h"
+
+DECLARE_CYCLE_STAT(TEXT("Projectile Batch Integrate"), STAT_ProjectileBatchIntegrate, STATGROUP_Game);
+DECLARE_CYCLE_STAT(TEXT("Projectile Batch Apply"), STAT_ProjectileBatchApply, STATGROUP_Game);
+DECLARE_CYCLE_STAT(TEXT("Projectile Batch Hit Resolve"), STAT_ProjectileBatchHitResolve, STATGROUP_Game);
+
+static TAutoConsoleVariable<int32> CVarProjectileBatchedUpdate(
+	TEXT("GP4.Projectiles.BatchedUpdate"), 1,
+	TEXT("1: actor bullets are moved by UProjectileUpdateSubsystem. 0: every bullet ticks itself."),
+	ECVF_Default);
+
+static TAutoConsoleVariable<int32> CVarProjectileParallelUpdate(
+	TEXT("GP4.Projectiles.ParallelUpdate"), 1,
+	TEXT("1: integrate bullet positions with ParallelFor once there are enough of them."),
+	ECVF_Default);
+
+namespace ProjectileUpdate
+{
+	// Below this the task dispatch costs more than the integration itself
+	constexpr int32 MinParallelBatch = 512;
+}
+
+bool UProjectileUpdateSubsystem::IsBatchingEnabled()
+{
+	return CVarProjectileBatchedUpdate.GetValueOnGameThread() != 0;
+}
+
+void UProjectileUpdateSubsystem::Deinitialize()
+{
+	for (ABullet* Bullet : Bullets)
+	{
+		if (Bullet) Bullet->ProjectileUpdateIndex = INDEX_NONE;
+	}
+	Bullets.Empty();
+	Locations.Empty();
+	Directions.Empty();
+	Speeds.Empty();
+	Sweeps.Empty();
+	PendingHits.Empty();
+
+	Super::Deinitialize();
+}
+
+void UProjectileUpdateSubsystem::RegisterBullet(ABullet* Bullet, float Speed)
+{
+	if (!IsValid(Bullet)) return;
+
+	int32 Index = Bullet->ProjectileUpdateIndex;
+	if (!Bullets.IsValidIndex(Index) || Bullets[Index] != Bullet)
+	{
+		Index = Bullets.Add(Bullet);
+		Locations.AddUninitialized();
+		Directions.AddUninitialized();
+		Speeds.AddUninitialized();
+		Sweeps.AddUninitialized();
+		Bullet->ProjectileUpdateIndex = Index;
+	}
+
+	Locations[Index] = Bullet->GetActorLocation();
+	Directions[Index] = Bullet->GetActorForwardVector();
+	Speeds[Index] = Speed;
+	Sweeps[Index] = Bullet->UsesSweepHitDetection();
+}
+
+void UProjectileUpdateSubsystem::UnregisterBullet(ABullet* Bullet)
+{
+	if (!Bullet) return;
+
+	const int32 Index = Bullet->ProjectileUpdateIndex;
+	Bullet->ProjectileUpdateIndex = INDEX_NONE;
+	if (!Bullets.IsValidIndex(Index) || Bullets[Index] != Bullet) return;
+
+	RemoveAtIndex(Index);
+}
+
+void UProjectileUpdateSubsystem::RemoveAtIndex(int32 Index)
+{
+	const int32 Last = Bullets.Num() - 1;
+	Bullets.RemoveAtSwap(Index, EAllowShrinking::No);
+	Locations.RemoveAtSwap(Index, EAllowShrinking::No);
+	Directions.RemoveAtSwap(Index, EAllowShrinking::No);
+	Speeds.RemoveAtSwap(Index, EAllowShrinking::No);
+	Sweeps.RemoveAtSwap(Index, EAllowShrinking::No);
+	if (Index != Last && Bullets[Index]) Bullets[Index]->ProjectileUpdateIndex = Index;
+}
+
+void UProjectileUpdateSubsystem::Tick(float DeltaTime)
+{
+	Super::Tick(DeltaTime);
+
+	const int32 Count = Bullets.Num();
+	{
+		SCOPE_CYCLE_COUNTER(STAT_ProjectileBatchIntegrate);
+
+		FVector* RESTRICT LocationData = Locations.GetData();
+		const FVector* RESTRICT DirectionData = Directions.GetData();
+		const float* RESTRICT SpeedData = Speeds.GetData();
+		auto Integrate = [=](int32 i) { LocationData[i] += DirectionData[i] * (SpeedData[i] * DeltaTime); };
+
+		if (CVarProjectileParallelUpdate.GetValueOnGameThread() != 0 && Count >= ProjectileUpdate::MinParallelBatch)
+		{
+			ParallelFor(Count, Integrate);
+		}
+		else
+		{
+			for (int32 i = 0; i < Count; ++i) Integrate(i);
+		}
+	}
+
+	{
+		SCOPE_CYCLE_COUNTER(STAT_ProjectileBatchApply);
+
+		// Moving a bullet can fire its overlap and release it (swap-remove), so walk backwards
+		for (int32 i = Count - 1; i >= 0; --i)
+		{
+			if (i >= Bullets.Num()) continue;
+
+			ABullet* Bullet = Bullets[i];
+			if (!IsValid(Bullet))
+			{
+				// Destroyed without EndPlay reaching us (world teardown)
+				RemoveAtIndex(i);
+				continue;
+			}
+
+			if (Sweeps[i])
+			{
+				FHitResult Hit;
+				if (Bullet->SweepForHit(Bullet->GetActorLocation(), Locations[i], Hit))
+				{
+					Locations[i] = Hit.Location;
+					PendingHits.Add({ Bullet, MoveTemp(Hit) });
+				}
+				Bullet->SetActorLocation(Locations[i]);
+				continue;
+			}
+
+			// Overlap bullets move swept, as the projectile movement component did, so targets thinner than one
+			// frame's travel still raise their overlap
+			FHitResult BlockingHit;
+			Bullet->SetActorLocation(Locations[i], true, &BlockingHit);
+
+			// The overlap may have released the bullet; if not and something blocked it, stay where the sweep stopped
+			if (BlockingHit.bBlockingHit && Bullets.IsValidIndex(i) && Bullets[i] == Bullet)
+			{
+				Locations[i] = Bullet->GetActorLocation();
+			}
+		}
+	}
+
+	if (PendingHits.Num() == 0) return;
+
+	SCOPE_CYCLE_COUNTER(STAT_ProjectileBatchHitResolve);
+
+	// Resolving damages, releases and can end the world; work from a local array and hand the buffer back after
+	TArray<FPendingBulletHit> Hits = MoveTemp(PendingHits);
+	PendingHits.Reset();
+	for (const FPendingBulletHit& Pending : Hits)
+	{
+		ABullet* Bullet = Pending.Bullet.Get();
+		if (!IsValid(Bullet) || Bullet->ProjectileUpdateIndex == INDEX_NONE) continue;
+		Bullet->HandleSweepHit(Pending.Hit);
+	}
+	PendingHits = MoveTemp(Hits);
+	PendingHits.Reset();
+}
@@ -9,6 +9,7 @@
 #include "Systems/CombatSystem/States/FireState.h"
 #include "Systems/CombatSystem/States/IdleState.h"
 #include "ObjectPool/ObjectPoolSubsystem.h"
+#include "Systems/CombatSystem/Bullets/ProjectileSimulationSubsystem.h"
 #include "Debug.h"
 
 
@@ -34,6 +35,7 @@ void UCombatComponent::BeginPlay()
 	if (Owner) AttributeComponent = Owner->GetComponentByClass<UAttributeComponent>();
 	
 	CombatEventsSubsystem = GetWorld()->GetSubsystem<UCombatEventsSubsystem>();
+	ProjectileSimulation = GetWorld()->GetSubsystem<UProjectileSimulationSubsystem>();
 
 	// look trace subsystem
 	PlayerController = Cast<APlayerController>(Pawn->GetController());
@@ -46,21 +48,24 @@ void UCombatComponent::BeginPlay()
 	{
 		PoolSubsystem = GI->GetSubsystem<UObjectPoolSubsystem>();
 		Debug::Log(FString::Printf(TEXT("[Combat] PoolSubsystem cached = %p"), PoolSubsystem), bDebugOnScreen, DebugDuration);
-		if (PoolSubsystem)
+		// Simulated bullets never acquire actors, so their pools would only sit there warm
+		if (PoolSubsystem && BulletSimulationMode == EBulletSimulationMode::Actor)
 		{
 			// Pre-register pools
 			if (StandardBullet)
 			{
 				const FString StdName = GetNameSafe(*StandardBullet);
 				Debug::Log(FString::Printf(TEXT("[Combat] RegisterPool StandardBullet=%s size=%d"), *StdName, BulletPoolInitialSize), bDebugOnScreen, DebugDuration);
-				PoolSubsystem->RegisterPool(StandardBullet, BulletPoolInitialSize);
+				StandardBulletPool = PoolSubsystem->RegisterPoolWithPolicy(StandardBullet, BulletPoolInitialSize, BulletPoolGrowth);
+				PoolSubsystem->SetTrimPolicy(StandardBulletPool, BulletPoolTrim);
 			}
 			if (OneShotBullet)
 			{
 				int32 OneShotSize = FMath::Max(1, BulletPoolInitialSize / 2);
 				const FString OneShotName = GetNameSafe(*OneShotBullet);
 				Debug::Log(FString::Printf(TEXT("[Combat] RegisterPool OneShotBullet=%s size=%d"), *OneShotName, OneShotSize), bDebugOnScreen, DebugDuration);
-				PoolSubsystem->RegisterPool(OneShotBullet, OneShotSize);
+				OneShotBulletPool = PoolSubsystem->RegisterPoolWithPolicy(OneShotBullet, OneShotSize, BulletPoolGrowth);
+				PoolSubsystem->SetTrimPolicy(OneShotBulletPool, BulletPoolTrim);
 			}
 		}
 	}
@@ -69,7 +74,7 @@ void UCombatComponent::BeginPlay()
 	CurrentFireChargeCapacity = MaxFireChargeCapacity;
 
 	float MeleeCooldown = 0;
-	if (AttributeComponent) MeleeCooldown = AttributeComponent->GetAttributeValue(AttributeTags::Attribute_Melee_Cooldown);
+	if (AttributeComponent) MeleeCooldown = AttributeComponent->GetAttributeValue(EAttributeId::Melee_Cooldown);
 	else MeleeCooldown = FallbackMeleeCooldown;
 	
 	CurrentMeleeCooldownTime = MeleeCooldown;
@@ -178,15 +183,48 @@ void UCombatComponent::TickComponent(float DeltaTime, ELevelTick TickType, FActo
 	TickFireCooldown(DeltaTime);
 	TickFireRecharge(DeltaTime);
 	TickMeleeCooldown(DeltaTime);
+	TickAsyncAimTrace();
 	CombatFSM->Tick(DeltaTime, InputContext);
 }
 
+void UCombatComponent::TickAsyncAimTrace()
+{
+	if (!LookTraceSubsystem || !PlayerController) return;
+
+	if (!InputContext.bWantsToFire)
+	{
+		LookTraceSubsystem->CancelAsyncTrace(AimTraceHandle);
+		return;
+	}
+
+	// a request still in flight keeps its handle; a new one only goes out once its result was read
+	FLookTraceCallerScope TraceCaller(LookTraceSubsystem, TEXT("CombatComponent.AsyncAim"));
+	FHitResult Hit;
+	const bool bHasResult = LookTraceSubsystem->PollAsyncTrace(AimTraceHandle, Hit, [this]()
+	{
+		return LookTraceSubsystem->RequestCameraSphereTraceAsync(PlayerController, 100000.0f, 1.0f, ECollisionChannel::ECC_Visibility, ELookTracePreset::PlayerAim);
+	});
+	if (bHasResult)
+	{
+		AsyncAimPoint = Hit.Location;
+		AsyncAimPointFrame = GFrameCounter;
+	}
+}
+
+FVector UCombatComponent::GetAimPoint()
+{
+	// First shot of a burst has no async result yet, so it pays for one blocking trace
+	if (GFrameCounter - AsyncAimPointFrame <= 1) return AsyncAimPoint;
+	FLookTraceCallerScope TraceCaller(LookTraceSubsystem, TEXT("CombatComponent.Aim"));
+	return LookTraceSubsystem->GetLocationFromCameraLineTrace(PlayerController, 100000.0f, 1.0f, ECollisionChannel::ECC_Visibility, ELookTracePreset::PlayerAim);
+}
+
 
 //Value Setting
 void UCombatComponent::TickFireCooldown(float DeltaTime)
 {
 	float FireDelay = FallbackFireDelay;
-	if (AttributeComponent) FireDelay = AttributeComponent->GetAttributeValue(AttributeTags::Attribute_Weapon_FireDelay);
+	if (AttributeComponent) FireDelay = AttributeComponent->GetAttributeValue(EAttributeId::Weapon_FireDelay);
 	
 	if (CurrentFireCooldownTime < FireDelay)
 	{
@@ -235,7 +273,7 @@ void UCombatComponent::TickFireRecharge(float DeltaTime)
 void UCombatComponent::TickMeleeCooldown(float DeltaTime)
 {
 	float MeleeCooldown = FallbackMeleeCooldown;
-	if (AttributeComponent) MeleeCooldown = AttributeComponent->GetAttributeValue(AttributeTags::Attribute_Melee_Cooldown);
+	if (AttributeComponent) MeleeCooldown = AttributeComponent->GetAttributeValue(EAttributeId::Melee_Cooldown);
 	
 	if (CurrentMeleeCooldownTime < MeleeCooldown)
 	{
@@ -276,7 +314,7 @@ void UCombatComponent::OnFireExecuted()
 	else
 	{
 		float RechargeRateRegular = FallbackRegularRechargeRate;
-		if (AttributeComponent) RechargeRateRegular = AttributeComponent->GetAttributeValue(AttributeTags::Attribute_Weapon_ReloadSpeed);
+		if (AttributeComponent) RechargeRateRegular = AttributeComponent->GetAttributeValue(EAttributeId::Weapon_ReloadSpeed);
 		CurrentFireRechargeRate = RechargeRateRegular;
 	}
 }
@@ -311,7 +349,8 @@ void UCombatComponent::Fire()
 	FTransform FirePoint = GunMeshComp->GetSocketTransform(GunMeshFirePointSocket);
 
 	if (!PlayerController) return;
-	FVector AimPoint = LookTraceSubsystem->GetLocationFromCameraLineTrace(PlayerController, 100000.0f, 1.0f, ECollisionChannel::ECC_Visibility);
+	if (!LookTraceSubsystem) return;
+	FVector AimPoint = GetAimPoint();
 
 	FRotator ShootRotation;
 	if (AimPoint == FVector(0,0,0)) ShootRotation = FirePoint.Rotator();
@@ -319,25 +358,50 @@ void UCombatComponent::Fire()
 	
 	// resolve bullet class
 	TSubclassOf<ABullet> BulletToFire = UseOneShotBullet ? OneShotBullet : StandardBullet;
-	const FString BulletClassName = BulletToFire ? GetNameSafe(*BulletToFire) : FString(TEXT("<null>"));
-	Debug::Log(FString::Printf(TEXT("[Combat] Fire: UseOneShot=%d BulletClass=%s PoolSubsystem=%p"),
-		UseOneShotBullet ? 1 : 0, *BulletClassName, PoolSubsystem), bDebugOnScreen, DebugDuration);
+	const FPoolHandle BulletPool = UseOneShotBullet ? OneShotBulletPool : StandardBulletPool;
+	if (bDebugOnScreen)
+	{
+		Debug::Log(FString::Printf(TEXT("[Combat] Fire: UseOneShot=%d BulletClass=%s PoolHandle=%d"),
+			UseOneShotBullet ? 1 : 0, *GetNameSafe(*BulletToFire), BulletPool.Index), bDebugOnScreen, DebugDuration);
+	}
 	if (!BulletToFire) return;
+
+	float FireDamage = FallbackFireDamage;
+	if (AttributeComponent) FireDamage = AttributeComponent->GetAttributeValue(EAttributeId::Weapon_Damage);
+
+	// Simulated rounds never touch the pool or spawn an actor
+	if (BulletSimulationMode == EBulletSimulationMode::Simulated && ProjectileSimulation)
+	{
+		const ABullet* BulletDefaults = GetDefault<ABullet>(BulletToFire);
+
+		FProjectileSpawnParams Params;
+		Params.BulletClass = BulletToFire;
+		Params.Origin = FirePoint.GetLocation();
+		Params.Direction = ShootRotation.Vector();
+		Params.Damage = FireDamage * BulletDefaults->GetDamageMultiplier();
+		Params.Speed = BulletSpeed * BulletDefaults->GetSpeedMultiplier();
+		Params.Radius = SimulatedBulletRadius;
+		Params.Lifetime = SimulatedBulletLifetime;
+		Params.TraceChannel = CombatTraceChannel;
+		Params.Owner = GetOwner();
+		Params.Instigator = SpawnParams.Instigator;
+		ProjectileSimulation->SpawnProjectile(Params);
+		return;
+	}
 	
 	ABullet* SpawnedBullet = nullptr;
 
-	// Acquire from pool via cached subsystem (fast path)
-	if (PoolSubsystem)
+	// Acquire from pool via cached handle (fast path)
+	if (PoolSubsystem && BulletPool.IsValid())
 	{
-		AActor* PooledActor = PoolSubsystem->AcquireActor(BulletToFire);
-		SpawnedBullet = Cast<ABullet>(PooledActor);
-		Debug::Log(FString::Printf(TEXT("[Combat] Acquire returned %p (cast to ABullet %p)"), PooledActor, SpawnedBullet), bDebugOnScreen, DebugDuration);
+		SpawnedBullet = Cast<ABullet>(PoolSubsystem->AcquireActorByHandle(BulletPool));
 	}
 
 	// Fallback to spawning if pooling is unavailable or failed
 	if (!SpawnedBullet)
 	{
 		Debug::Log(TEXT("[Combat] Pool acquire failed; spawning new bullet"), bDebugOnScreen, DebugDuration);
+		if (PoolSubsystem) PoolSubsystem->RecordFallbackSpawn(BulletPool);
 		SpawnedBullet = GetWorld()->SpawnActor<ABullet>(
 			BulletToFire,
 			FirePoint.GetLocation(),
@@ -355,14 +419,13 @@ void UCombatComponent::Fire()
 	SpawnedBullet->SetActorLocationAndRotation(FirePoint.GetLocation(), ShootRotation);
 	SpawnedBullet->SetOwner(GetOwner());
 	SpawnedBullet->SetInstigator(SpawnParams.Instigator);
-
-	float FireDamage = FallbackFireDamage;
-	if (AttributeComponent) FireDamage = AttributeComponent->GetAttributeValue(AttributeTags::Attribute_Weapon_Damage);
 	
 	SpawnedBullet->Init(CombatEventsSubsystem, FireDamage, BulletSpeed);
-	const FString SpawnedName = GetNameSafe(SpawnedBullet);
-	Debug::Log(FString::Printf(TEXT("[Combat] Bullet initialized: %s (%p) Damage=%.2f Speed=%.2f"),
-		*SpawnedName, SpawnedBullet, FireDamage, BulletSpeed), bDebugOnScreen, DebugDuration);
+	if (bDebugOnScreen)
+	{
+		Debug::Log(FString::Printf(TEXT("[Combat] Bullet initialized: %s (%p) Damage=%.2f Speed=%.2f"),
+			*GetNameSafe(SpawnedBullet), SpawnedBullet, FireDamage, BulletSpeed), bDebugOnScreen, DebugDuration);
+	}
 }
 
 
@@ -371,9 +434,10 @@ void UCombatComponent::SetBullet(TSubclassOf<ABullet> Bullet)
 {
 	StandardBullet = Bullet;
 	// Register pool for new bullet type to avoid runtime cost
-	if (PoolSubsystem && StandardBullet)
+	if (PoolSubsystem && StandardBullet && BulletSimulationMode == EBulletSimulationMode::Actor)
 	{
-		PoolSubsystem->RegisterPool(StandardBullet, BulletPoolInitialSize);
+		StandardBulletPool = PoolSubsystem->RegisterPoolWithPolicy(StandardBullet, BulletPoolInitialSize, BulletPoolGrowth);
+		PoolSubsystem->SetTrimPolicy(StandardBulletPool, BulletPoolTrim);
 	}
 }
 
@@ -381,15 +445,17 @@ void UCombatComponent::SetOneShotBullet(TSubclassOf<ABullet> Bullet)
 {
 	OneShotBullet = Bullet;
 	UseOneShotBullet = true;
-	if (PoolSubsystem && OneShotBullet)
+	if (PoolSubsystem && OneShotBullet && BulletSimulationMode == EBulletSimulationMode::Actor)
 	{
-		PoolSubsystem->RegisterPool(OneShotBullet, FMath::Max(1, BulletPoolInitialSize / 4));
+		OneShotBulletPool = PoolSubsystem->RegisterPoolWithPolicy(OneShotBullet, FMath::Max(1, BulletPoolInitialSize / 4), BulletPoolGrowth);
+		PoolSubsystem->SetTrimPolicy(OneShotBulletPool, BulletPoolTrim);
 	}
 }
 
 void UCombatComponent::ResetOneShotBullet()
 {
 	OneShotBullet = nullptr;
+	OneShotBulletPool = FPoolHandle();
 	UseOneShotBullet = false;
 }
 
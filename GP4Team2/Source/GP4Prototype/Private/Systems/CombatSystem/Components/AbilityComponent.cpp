@@ -1,6 +1,8 @@
 #include "Systems/CombatSystem/Components/AbilityComponent.h"
 
+#include "Components/AudioComponent.h"
 #include "Kismet/GameplayStatics.h"
+#include "Sound/SoundBase.h"
 
 // setup
 UAbilityComponent::UAbilityComponent()
@@ -20,6 +22,14 @@ void UAbilityComponent::BeginPlay()
 		AddPassiveAbility(StartingPassiveAbility);
 }
 
+void UAbilityComponent::EndPlay(const EEndPlayReason::Type EndPlayReason)
+{
+	// Components are owned by our actor and go away with it
+	SoundPool.Reset();
+
+	Super::EndPlay(EndPlayReason);
+}
+
 
 // tick
 void UAbilityComponent::TickComponent(float DeltaTime, enum ELevelTick TickType,
@@ -159,9 +169,72 @@ AActor* UAbilityComponent::SpawnActorForAbility(TSubclassOf<AActor> Class, const
 
 void UAbilityComponent::PlaySound2D(USoundBase* Sound, UAudioComponent*& OutAudioComp)
 {
-	if (Sound && GetWorld())
+	if (!Sound || !GetWorld() || !GetOwner()) return;
+	if (!GEngine || !GEngine->UseSound()) return;
+
+	if (!SoundPool)
+	{
+		SoundPool = MakeUnique<TObjectPool<UAudioComponent>>(
+			[this]() { return CreatePooledSound(); },
+			[](UAudioComponent* AudioComp, bool bActive)
+			{
+				if (bActive) return;
+				AudioComp->Stop();
+				AudioComp->SetSound(nullptr);
+			},
+			SoundPoolSize);
+	}
+
+	UAudioComponent* AudioComp = SoundPool->Acquire();
+	if (!AudioComp && SoundPool->Grow(1) > 0)
+	{
+		AudioComp = SoundPool->Acquire();
+	}
+
+	if (!AudioComp)
+	{
+		// Pool could not produce a component, keep the old fire-and-forget path
+		OutAudioComp = UGameplayStatics::SpawnSound2D(this, Sound);
+		return;
+	}
+
+	AudioComp->SetSound(Sound);
+	AudioComp->Play();
+	OutAudioComp = AudioComp;
+}
+
+UAudioComponent* UAbilityComponent::CreatePooledSound()
+{
+	AActor* Owner = GetOwner();
+	if (!Owner) return nullptr;
+
+	// Same setup SpawnSound2D uses, minus auto destroy
+	UAudioComponent* AudioComp = NewObject<UAudioComponent>(Owner);
+	AudioComp->bAutoActivate = false;
+	AudioComp->bAutoDestroy = false;
+	AudioComp->bAllowSpatialization = false;
+	AudioComp->bIsUISound = true;
+	AudioComp->RegisterComponent();
+	AudioComp->OnAudioFinishedNative.AddUObject(this, &UAbilityComponent::OnPooledSoundFinished);
+	return AudioComp;
+}
+
+void UAbilityComponent::OnPooledSoundFinished(UAudioComponent* AudioComp)
+{
+	// Stop() in the reset functor broadcasts again; the pool ignores the second release
+	if (SoundPool)
+	{
+		SoundPool->Release(AudioComp);
+	}
+}
+
+void UAbilityComponent::AddReferencedObjects(UObject* InThis, FReferenceCollector& Collector)
+{
+	Super::AddReferencedObjects(InThis, Collector);
+
+	UAbilityComponent* This = CastChecked<UAbilityComponent>(InThis);
+	if (This->SoundPool)
 	{
-		UAudioComponent* AudioComp = UGameplayStatics::SpawnSound2D(this, Sound);
-		OutAudioComp = AudioComp;
+		This->SoundPool->AddReferencedObjects(Collector, This);
 	}
 }
@@ -51,7 +51,7 @@ bool UHealthComponent::OwnerIsPlayerControlled() const
 void UHealthComponent::InitHealth()
 {
 	float MaxHealth = FallbackMaxHealth;
-	if (AttributeComponent) MaxHealth =	AttributeComponent->GetAttributeValue(AttributeTags::Attribute_MaxHealth);
+	if (AttributeComponent) MaxHealth =	AttributeComponent->GetAttributeValue(EAttributeId::MaxHealth);
 
 	CurrentHealth = MaxHealth;
 }
@@ -73,7 +73,7 @@ float UHealthComponent::Heal(float Value)
 	if (bIsDead) return -1.f;
 
 	float MaxHealth = FallbackMaxHealth;
-	if (AttributeComponent) MaxHealth =	AttributeComponent->GetAttributeValue(AttributeTags::Attribute_MaxHealth);
+	if (AttributeComponent) MaxHealth =	AttributeComponent->GetAttributeValue(EAttributeId::MaxHealth);
 
 	CurrentHealth += Value;
 	if (CurrentHealth > MaxHealth)
@@ -142,7 +142,7 @@ void UHealthComponent::Die(EGameDamageType LastDamageTaken)
 	if (bResurrectUnlocked && !bResurrectHasBeenUsed)
 	{
 		float MaxHealth = FallbackMaxHealth;
-		if (AttributeComponent) MaxHealth =	AttributeComponent->GetAttributeValue(AttributeTags::Attribute_MaxHealth);
+		if (AttributeComponent) MaxHealth =	AttributeComponent->GetAttributeValue(EAttributeId::MaxHealth);
 		
 		CurrentHealth = MaxHealth * PercentageOfMaxHealthToReplenish;
 
@@ -37,7 +37,7 @@ void UKillTrackerComponent::AddKill()
 	TimeSinceLastKill = 0;
 
 	int KillStreakForOneShotBullet = FallbackKillStreakForOneShotBullet;
-	if (AttributeComponent) KillStreakForOneShotBullet = AttributeComponent->GetAttributeValue(AttributeTags::Attribute_Killstreak_ExplosiveRounds);
+	if (AttributeComponent) KillStreakForOneShotBullet = AttributeComponent->GetAttributeValue(EAttributeId::Killstreak_ExplosiveRounds);
 	
 	if (KillStreakForOneShotBullet < 1) KillStreakForOneShotBullet = 1;
 	
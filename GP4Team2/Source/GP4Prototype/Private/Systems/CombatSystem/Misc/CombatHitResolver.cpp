@@ -0,0 +1,115 @@
+#include "Systems/CombatSystem/Misc/CombatHitResolver.h"
+
+#include "Components/SkeletalMeshComponent.h"
+#include "Core/Data/Interfaces/Damageable.h"
+#include "GameFramework/Character.h"
+
+namespace CombatHitResolver
+{
+	const FName DamageableSkelMeshTag(TEXT("DamageableSkelMesh"));
+}
+
+void FCombatHitResolver::BeginSwing(AActor* InInstigator, const FCombatHitParams& InParams)
+{
+	Instigator = InInstigator;
+	Params = InParams;
+	HitThisSwing.Reset();
+}
+
+int32 FCombatHitResolver::ResolveHits(TConstArrayView<FHitResult> Hits)
+{
+	return ResolveHits(Hits, [](AActor*) {});
+}
+
+int32 FCombatHitResolver::ResolveHits(TConstArrayView<FHitResult> Hits, TFunctionRef<void(AActor* Victim)> OnVictim)
+{
+	const AActor* Source = Instigator.Get();
+	int32 NumVictims = 0;
+
+	for (const FHitResult& Hit : Hits)
+	{
+		if (HitThisSwing.Num() >= Params.MaxHits) break;
+
+		AActor* HitActor = Hit.GetActor();
+		if (!HitActor || HitActor == Source) continue;
+		if (!IsDamageableClass(HitActor->GetClass())) continue;
+
+		// several components of one actor in the same sweep, or an actor hit earlier in the swing
+		bool bAlreadyHit = false;
+		HitThisSwing.Add(HitActor, &bAlreadyHit);
+		if (bAlreadyHit) continue;
+
+		IDamageable::Execute_TakeDamage(HitActor, Params.DamageType, Params.Damage, 1.0f, "");
+		++NumVictims;
+
+		// a killing blow may have destroyed the victim already; it still gets the hit feedback and death impulse
+		OnVictim(HitActor);
+
+		//move these to enemy
+		KnockbackLiving(HitActor);
+		KnockbackDead(HitActor);
+	}
+
+	return NumVictims;
+}
+
+bool FCombatHitResolver::IsDamageableClass(const UClass* Class)
+{
+	if (!Class) return false;
+
+	if (const bool* Cached = DamageableByClass.Find(Class)) return *Cached;
+	return DamageableByClass.Add(Class, Class->ImplementsInterface(UDamageable::StaticClass()));
+}
+
+USkeletalMeshComponent* FCombatHitResolver::FindDamageableSkelMesh(AActor* Actor)
+{
+	if (!Actor) return nullptr;
+
+	const TObjectKey<UClass> ClassKey(Actor->GetClass());
+	if (const FName* CachedName = DamageableSkelMeshByClass.Find(ClassKey))
+	{
+		if (CachedName->IsNone()) return nullptr;
+
+		USkeletalMeshComponent* Cached = FindObjectFast<USkeletalMeshComponent>(Actor, *CachedName);
+		if (Cached && Cached->ComponentHasTag(CombatHitResolver::DamageableSkelMeshTag)) return Cached;
+	}
+
+	// first victim of this class (or an instance that differs from it): scan, last tagged mesh wins
+	USkeletalMeshComponent* Found = nullptr;
+	Actor->ForEachComponent<USkeletalMeshComponent>(false, [&Found](USkeletalMeshComponent* Skel)
+	{
+		if (Skel && Skel->ComponentHasTag(CombatHitResolver::DamageableSkelMeshTag)) Found = Skel;
+	});
+	DamageableSkelMeshByClass.Add(ClassKey, Found ? Found->GetFName() : NAME_None);
+	return Found;
+}
+
+void FCombatHitResolver::KnockbackLiving(AActor* Victim) const
+{
+	ACharacter* Char = Cast<ACharacter>(Victim);
+	const AActor* Source = Instigator.Get();
+	if (!Char || !Source) return;
+
+	// Direction from attacker -> victim (mostly horizontal)
+	FVector Dir = Char->GetActorLocation() - Source->GetActorLocation();
+	Dir.Z = 0.f;
+	Dir = Dir.GetSafeNormal();
+
+	const FVector LaunchVel = (Dir * Params.KnockbackForce) + FVector(0, 0, Params.KnockbackUpward);
+
+	// Add to current velocity (don't overwrite)
+	Char->LaunchCharacter(LaunchVel, false, false);
+}
+
+void FCombatHitResolver::KnockbackDead(AActor* Victim) const
+{
+	ACharacter* Char = Cast<ACharacter>(Victim);
+	const AActor* Source = Instigator.Get();
+	if (!Char || !Source) return;
+
+	USkeletalMeshComponent* SkeletalMeshComponent = Char->GetMesh();
+	if (!SkeletalMeshComponent) return;
+
+	const FVector Direction = (Victim->GetActorLocation() - Source->GetActorLocation()).GetSafeNormal();
+	SkeletalMeshComponent->AddImpulseToAllBodiesBelow(Direction * Params.KnockbackForceDead, NAME_None, true);
+}
@@ -3,8 +3,7 @@
 #include <Systems/AttributeSystem/AttributeTags.h>
 
 #include "Core/Data/Enums/GameDamageType.h"
-#include "Core/Data/Interfaces/Damageable.h"
-#include "GameFramework/Character.h"
+#include "Systems/AISpawningSystem/EnemyBroadphaseSubsystem.h"
 #include "Systems/AttributeSystem/AttributeComponent.h"
 #include "Systems/CombatSystem/CombatComponent.h"
 #include "Systems/CombatSystem/CombatFiniteStateMachine.h"
@@ -41,6 +40,8 @@ void UMeleeState::Init( float InitFallbackMeleeDamage,
 	// set look trace subsystem
 	APawn* OwnerPawn = CombatFSM->GetOwnerPawn();
 	if (!OwnerPawn) return;
+
+	EnemyBroadphase = OwnerPawn->GetWorld()->GetSubsystem<UEnemyBroadphaseSubsystem>();
 	
 	APlayerController* PlayerController = Cast<APlayerController>(OwnerPawn->GetController());
 	if (!PlayerController) return;
@@ -49,6 +50,7 @@ void UMeleeState::Init( float InitFallbackMeleeDamage,
 	if (!LocalPlayer) return;
 	
 	LookTraceSubsystem = LocalPlayer->GetSubsystem<ULookTraceSubsystem>();
+	if (LookTraceSubsystem) LookTraceSubsystem->RegisterQueryPresets(OwnerPawn);
 
 
 	// set controller
@@ -115,9 +117,25 @@ bool UMeleeState::Enter(FCombatContext Context)
 	CombatComponent->OnMeleeStart.Broadcast();
 	MeleeCurrentTime = 0;
 	MeleeActiveCurrentTime = 0;
-	DamagedActors.Empty();
 	bMeleeActive = false;
 
+	// attribute values for the whole swing
+	FCombatHitParams HitParams;
+	HitParams.DamageType = EGameDamageType::Melee;
+	HitParams.Damage = FallbackMeleeDamage;
+	HitParams.MaxHits = FallbackMaxMeleeHitCapacity;
+	HitParams.KnockbackForce = FallbackForwardMeleeKnockbackStrengthForSurvivingEnemies;
+	HitParams.KnockbackUpward = UpwardMeleeKnockbackStrengthForSurvivingEnemies;
+	HitParams.KnockbackForceDead = FallbackForwardMeleeKnockbackStrengthForDyingEnemies;
+	if (AttributeComponent)
+	{
+		HitParams.Damage = AttributeComponent->GetAttributeValue(EAttributeId::Melee_Damage);
+		HitParams.MaxHits = FMath::TruncToInt32(AttributeComponent->GetAttributeValue(EAttributeId::Melee_HitDetection));
+		HitParams.KnockbackForce = AttributeComponent->GetAttributeValue(EAttributeId::Melee_KnockbackForce);
+		HitParams.KnockbackForceDead = AttributeComponent->GetAttributeValue(EAttributeId::Melee_KnockbackForceDead);
+	}
+	HitResolver.BeginSwing(OwnerActor, HitParams);
+
 	//melee start
 	BatMeshComp->SetVisibility(true);
 	GunMeshComp->SetVisibility(false);
@@ -147,9 +165,15 @@ void UMeleeState::Tick(float DeltaTime, FCombatContext Context)
 
 		// GEngine->AddOnScreenDebugMessage(-1, 5.0f, FColor::Green, FString::Printf(TEXT("Location: %f"), Alpha));
 
-		//shoot trace from CurrentBase, with player forward
-		TArray<FHitResult> Hits = LookTraceSubsystem->GetHitResultFromLocationWithDirectionSphereTrace(OwnerActor->GetActorForwardVector(), CurrentLocation, MeleeReach, MeleeRadius, ECC_Camera);
-		for (auto Hit : Hits) OnMeleeHit(Hit);
+		//broadphase: only sweep when an enemy or other damageable is near the swing
+		const FVector SwingEnd = CurrentLocation + OwnerActor->GetActorForwardVector().GetSafeNormal() * MeleeReach;
+		if (!EnemyBroadphase || EnemyBroadphase->MayOverlapTargets(CurrentLocation, SwingEnd, MeleeRadius, OwnerActor))
+		{
+			//shoot trace from CurrentBase, with player forward
+			FLookTraceCallerScope TraceCaller(LookTraceSubsystem, TEXT("MeleeState.Swing"));
+			LookTraceSubsystem->SphereTraceFromLocationWithDirection(OwnerActor->GetActorForwardVector(), CurrentLocation, MeleeReach, MeleeRadius, ECC_Camera, ELookTracePreset::Melee, MeleeHits);
+			ResolveMeleeHits(MeleeHits);
+		}
 
 		MeleeActiveCurrentTime += DeltaTime;
 	}
@@ -172,90 +196,15 @@ bool UMeleeState::Exit()
 	return true;
 }
 
-void UMeleeState::OnMeleeHit(FHitResult Hit)	//subscribe to OnHitComponent with this
+void UMeleeState::OnMeleeHit(const FHitResult& Hit)	//subscribe to OnHitComponent with this
 {
-	AActor* HitActor = Hit.GetActor();
-	if (!HitActor) return;
-	if (HitActor == OwnerActor) return;
-	if (!HitActor->GetClass()->ImplementsInterface(UDamageable::StaticClass())) return;
-
-	if (DamagedActors.Contains(HitActor)) return;
-
-	
-	int MaxMeleeHitCapacity = FallbackMaxMeleeHitCapacity;
-	if (AttributeComponent) MaxMeleeHitCapacity = AttributeComponent->GetAttributeValue(AttributeTags::Attribute_Melee_HitDetection);
-
-	if (DamagedActors.Num() >= MaxMeleeHitCapacity) return;
-
-	
-	float MeleeDamage = FallbackMeleeDamage;
-	if (AttributeComponent) MeleeDamage = AttributeComponent->GetAttributeValue(AttributeTags::Attribute_Melee_Damage);
-	
-	IDamageable::Execute_TakeDamage(HitActor, EGameDamageType::Melee, MeleeDamage, 1.0f, "");
-	if (!HitActor) return;
-	
-	DamagedActors.Add(HitActor);
-
-	// get hit actor
-	USkeletalMeshComponent* SkelMesh = nullptr;
-	TArray<USkeletalMeshComponent*> SkeletalMeshes;
-	HitActor->GetComponents<USkeletalMeshComponent>(SkeletalMeshes);
-	for (USkeletalMeshComponent* Skel : SkeletalMeshes)
-	{
-		if (!Skel || !Skel->ComponentHasTag("DamageableSkelMesh")) continue;
-		SkelMesh = Skel;
-	}
-	CombatComponent->OnMeleeHit.Broadcast(SkelMesh);
-
-	//move these to enemy
-	KnockbackLiving(HitActor);
-	KnockbackDead(HitActor);
+	ResolveMeleeHits(MakeArrayView(&Hit, 1));
 }
 
-void UMeleeState::KnockbackLiving(AActor* HitActor)
+int32 UMeleeState::ResolveMeleeHits(TConstArrayView<FHitResult> Hits)
 {
-	// sigh --> todo: need a way to get the character easily --> do it in the enemies instead
-
-	if (!HitActor) return;
-	
-	ACharacter* Char = Cast<ACharacter>(HitActor);
-	if (Char)
+	return HitResolver.ResolveHits(Hits, [this](AActor* Victim)
 	{
-		// Direction from attacker -> victim (mostly horizontal)
-		FVector Dir = (Char->GetActorLocation() - CombatComponent->GetOwner()->GetActorLocation());
-		Dir.Z = 0.f;
-		Dir = Dir.GetSafeNormal();
-
-		
-		float ForwardMeleeKnockbackStrengthForSurvivingEnemies = FallbackForwardMeleeKnockbackStrengthForSurvivingEnemies;
-		if (AttributeComponent) ForwardMeleeKnockbackStrengthForSurvivingEnemies = AttributeComponent->GetAttributeValue(AttributeTags::Attribute_Melee_KnockbackForce);
-
-		const float HorizontalStrength = ForwardMeleeKnockbackStrengthForSurvivingEnemies;
-		const float VerticalBoost      = UpwardMeleeKnockbackStrengthForSurvivingEnemies;
-		const FVector LaunchVel = (Dir * HorizontalStrength) + FVector(0,0,VerticalBoost);
-
-		
-		// Add to current velocity (don’t overwrite):
-		const bool bXYOverride = false;
-		const bool bZOverride  = false;
-		Char->LaunchCharacter(LaunchVel, bXYOverride, bZOverride);
-	}
-}
-
-void UMeleeState::KnockbackDead(AActor* HitActor)
-{
-	if (!HitActor) return;
-	if (!CombatComponent) return;
-
-	ACharacter* Char = Cast<ACharacter>(HitActor);
-	if (!Char) return;
-	USkeletalMeshComponent* SkeletalMeshComponent = Char->GetMesh();
-	if (!SkeletalMeshComponent) return;
-
-	
-	float ForwardMeleeKnockbackStrengthForDyingEnemies = FallbackForwardMeleeKnockbackStrengthForDyingEnemies;
-	if (AttributeComponent) ForwardMeleeKnockbackStrengthForDyingEnemies = AttributeComponent->GetAttributeValue(AttributeTags::Attribute_Melee_KnockbackForceDead);
-
-	FVector Direction = (HitActor->GetActorLocation() - CombatComponent->GetOwner()->GetActorLocation()).GetSafeNormal();
-	SkeletalMeshComponent->AddImpulseToAllBodiesBelow(Direction * ForwardMeleeKnockbackStrengthForDyingEnemies, NAME_None, true);
+		if (CombatComponent) CombatComponent->OnMeleeHit.Broadcast(HitResolver.FindDamageableSkelMesh(Victim));
+	});
 }
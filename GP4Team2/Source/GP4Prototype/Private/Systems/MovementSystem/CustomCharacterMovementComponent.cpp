@@ -2,8 +2,11 @@
 
 #include <Systems/AttributeSystem/AttributeTags.h>
 
+#include "Engine/LocalPlayer.h"
 #include "GameFramework/CharacterMovementComponent.h"
 #include "GameFramework/Pawn.h"
+#include "GameFramework/PlayerController.h"
+#include "HAL/IConsoleManager.h"
 #include "GP4Prototype/Public/Core/ReusableSystems/FiniteStateMachine/BaseMovementFiniteStateMachine.h"
 #include "GP4Prototype/Public/Systems/MovementSystem/MovementFiniteStateMachine.h"
 #include "GP4Prototype/Public/Systems/MovementSystem/States/WalkState.h"
@@ -14,6 +17,11 @@
 #include "Systems/MovementSystem/States/SprintState.h"
 #include "Systems/MovementSystem/States/SlideVaultState.h"
 
+static TAutoConsoleVariable<int32> CVarAdaptiveMovementProbes(
+	TEXT("GP4.Movement.AdaptiveProbes"), 1,
+	TEXT("1: vault probes trace ahead and are rescheduled by speed and distance to geometry. 0: trace every tick."),
+	ECVF_Default);
+
 UCustomCharacterMovementComponent::UCustomCharacterMovementComponent()
 {
 	PrimaryComponentTick.bCanEverTick = true;
@@ -34,10 +42,22 @@ void UCustomCharacterMovementComponent::BeginPlay()
 
 	if (Owner) AttributeComponent = Owner->GetComponentByClass<UAttributeComponent>();
 
+	if (APlayerController* PlayerController = Cast<APlayerController>(Pawn->GetController()))
+	{
+		if (ULocalPlayer* LocalPlayer = PlayerController->GetLocalPlayer()) LookTraceSubsystem = LocalPlayer->GetSubsystem<ULookTraceSubsystem>();
+	}
+
+	FMovementProbeSettings ProbeSettings;
+	ProbeSettings.MinInterval = VaultProbeMinInterval;
+	ProbeSettings.MaxInterval = VaultProbeMaxInterval;
+	ProbeSettings.ReuseDistance = VaultProbeReuseDistance;
+	ProbeSettings.ReuseAngleDegrees = VaultProbeReuseAngle;
+	ProbeScheduler.SetSettings(ProbeSettings);
+
 	
 	//Initial Value
 	float DashCharges = FallbackMaxDashCharges;
-	if (AttributeComponent) DashCharges = AttributeComponent->GetAttributeValue(AttributeTags::Attribute_Dash_MaxCharges);
+	if (AttributeComponent) DashCharges = AttributeComponent->GetAttributeValue(EAttributeId::Dash_MaxCharges);
 	
 	CurrentDashCharges = DashCharges;
 	CurrentDashCooldownTime = 0;
@@ -118,10 +138,10 @@ void UCustomCharacterMovementComponent::TickComponent(float DeltaTime, ELevelTic
 void UCustomCharacterMovementComponent::TickDashCooldown(float DeltaTime)
 {
 	float CooldownTime = FallbackDashCooldownPerChargeTime;
-	if (AttributeComponent) CooldownTime = AttributeComponent->GetAttributeValue(AttributeTags::Attribute_Dash_CooldownPerCharge);
+	if (AttributeComponent) CooldownTime = AttributeComponent->GetAttributeValue(EAttributeId::Dash_CooldownPerCharge);
 
 	float DashCharges = FallbackMaxDashCharges;
-	if (AttributeComponent) DashCharges = AttributeComponent->GetAttributeValue(AttributeTags::Attribute_Dash_MaxCharges);
+	if (AttributeComponent) DashCharges = AttributeComponent->GetAttributeValue(EAttributeId::Dash_MaxCharges);
 
 	if (CurrentDashCharges < DashCharges)
 	{
@@ -144,7 +164,7 @@ void UCustomCharacterMovementComponent::TickDashCooldown(float DeltaTime)
 void UCustomCharacterMovementComponent::TickSlideCooldown(float DeltaTime)
 {
 	float SlideCooldownTime = FallbackSlideCooldownTime;
-	if (AttributeComponent) SlideCooldownTime = AttributeComponent->GetAttributeValue(AttributeTags::Attribute_Slide_Cooldown);
+	if (AttributeComponent) SlideCooldownTime = AttributeComponent->GetAttributeValue(EAttributeId::Slide_Cooldown);
 	
 	if (CurrentSlideCooldownTime < SlideCooldownTime)
 	{
@@ -217,6 +237,65 @@ void UCustomCharacterMovementComponent::OnSlideVaultExecuted()
 }
 
 
+// movement probes
+bool UCustomCharacterMovementComponent::ProbeForward(EMovementProbe Probe, float TraceLength, float TraceRadius,
+	ECollisionChannel TraceChannel, bool bAsync, FHitResult& OutHit)
+{
+	if (!LookTraceSubsystem || !Pawn) return false;
+
+	const double Now = GetWorld()->GetTimeSeconds();
+	const FVector Location = Pawn->GetActorLocation();
+	const FVector Forward = Pawn->GetActorForwardVector();
+	const float Speed = FMath::Max(FVector::DotProduct(Pawn->GetVelocity(), Forward), 0.f);
+
+	// pick up last frame's async probe
+	FPendingProbe& Pending = PendingProbes[static_cast<int32>(Probe)];
+	if (Pending.Handle.IsValid())
+	{
+		FHitResult Hit;
+		if (LookTraceSubsystem->ConsumeAsyncTrace(Pending.Handle, Hit))
+		{
+			ProbeScheduler.RecordProbe(Probe, Pending.Time, Pending.Origin, Pending.Forward, Pending.Speed, TraceLength, Hit);
+		}
+	}
+
+	const bool bAdaptive = CVarAdaptiveMovementProbes.GetValueOnGameThread() != 0;
+	if (!Pending.Handle.IsValid() && (!bAdaptive || ProbeScheduler.ShouldProbe(Probe, Now, Location, Forward)))
+	{
+		const float ProbeLength = bAdaptive ? ProbeScheduler.GetLookaheadLength(TraceLength, Speed) : TraceLength;
+
+		if (bAsync)
+		{
+			Pending.Handle = LookTraceSubsystem->RequestPawnForwardSphereTraceAsync(Pawn, ProbeLength, TraceRadius, TraceChannel, ELookTracePreset::VaultProbe);
+			Pending.Time = Now;
+			Pending.Origin = Location;
+			Pending.Forward = Forward;
+			Pending.Speed = Speed;
+		}
+		else
+		{
+			const FHitResult Hit = LookTraceSubsystem->GetHitResultFromPawnForwardSphereTrace(Pawn, ProbeLength, TraceRadius, TraceChannel, ELookTracePreset::VaultProbe);
+			ProbeScheduler.RecordProbe(Probe, Now, Location, Forward, Speed, TraceLength, Hit);
+		}
+	}
+
+	return ProbeScheduler.GetHitInRange(Probe, Location, TraceLength, OutHit);
+}
+
+void UCustomCharacterMovementComponent::ResetProbe(EMovementProbe Probe)
+{
+	FPendingProbe& Pending = PendingProbes[static_cast<int32>(Probe)];
+	if (LookTraceSubsystem) LookTraceSubsystem->CancelAsyncTrace(Pending.Handle);
+	ProbeScheduler.Invalidate(Probe);
+}
+
+void UCustomCharacterMovementComponent::GetProbeStats(EMovementProbe Probe, int32& OutProbes, int32& OutReuses) const
+{
+	OutProbes = ProbeScheduler.GetNumProbes(Probe);
+	OutReuses = ProbeScheduler.GetNumReuses(Probe);
+}
+
+
 // event subscriptions
 void UCustomCharacterMovementComponent::OnAttributeValueChanged(FGameplayTag AttributeTag, float OldValue, float NewValue)
 {
@@ -0,0 +1,78 @@
+#include "Systems/MovementSystem/MovementProbeScheduler.h"
+
+bool FMovementProbeScheduler::ShouldProbe(EMovementProbe Probe, double Now, const FVector& Location, const FVector& Forward)
+{
+	FProbeSlot& Slot = Slots[static_cast<int32>(Probe)];
+	if (!Slot.bValid) return true;
+
+	// turned away from the probed line
+	if (FVector::DotProduct(Slot.Forward, Forward.GetSafeNormal()) < FMath::Cos(FMath::DegreesToRadians(Settings.ReuseAngleDegrees))) return true;
+
+	const FVector Moved = Location - Slot.Origin;
+	const float Along = FVector::DotProduct(Moved, Slot.Forward);
+	const float Across = (Moved - Slot.Forward * Along).Size();
+
+	// left the probed line, or ran past what the probe saw
+	if (Across > Settings.ReuseDistance) return true;
+	if (Along > Slot.CoveredAhead) return true;
+
+	// due, and moved enough for a new probe to see anything different
+	if (Now >= Slot.NextProbeTime && FMath::Abs(Along) >= Settings.ReuseDistance) return true;
+
+	Slot.NumReuses++;
+	return false;
+}
+
+float FMovementProbeScheduler::GetLookaheadLength(float TraceLength, float Speed) const
+{
+	// twice the distance until the next probe is due, so a late frame or some acceleration never outruns it
+	return TraceLength + 2.f * FMath::Max(Speed, 0.f) * Settings.MaxInterval + Settings.ReuseDistance;
+}
+
+void FMovementProbeScheduler::RecordProbe(EMovementProbe Probe, double Now, const FVector& Origin, const FVector& Forward,
+	float Speed, float TraceLength, const FHitResult& Hit)
+{
+	FProbeSlot& Slot = Slots[static_cast<int32>(Probe)];
+	Slot.bValid = true;
+	Slot.Origin = Origin;
+	Slot.Forward = Forward.GetSafeNormal();
+	Slot.CoveredAhead = GetLookaheadLength(TraceLength, Speed) - TraceLength;
+	Slot.Hit = Hit;
+	Slot.NumProbes++;
+
+	// refresh sooner the sooner the hit geometry comes into reach
+	float Interval = Settings.MaxInterval;
+	if (Hit.bBlockingHit)
+	{
+		const float TimeToReach = Speed > KINDA_SMALL_NUMBER ? (Hit.Distance - TraceLength) / Speed : Settings.MaxInterval;
+		Interval = FMath::Clamp(TimeToReach, Settings.MinInterval, Settings.MaxInterval);
+	}
+	Slot.NextProbeTime = Now + Interval;
+}
+
+bool FMovementProbeScheduler::GetHitInRange(EMovementProbe Probe, const FVector& Location, float TraceLength, FHitResult& OutHit) const
+{
+	const FProbeSlot& Slot = Slots[static_cast<int32>(Probe)];
+	if (!Slot.bValid || !Slot.Hit.bBlockingHit) return false;
+
+	const float Distance = Slot.Hit.Distance - FVector::DotProduct(Location - Slot.Origin, Slot.Forward);
+	if (Distance > TraceLength) return false;
+
+	OutHit = Slot.Hit;
+	OutHit.Distance = FMath::Max(Distance, 0.f);
+	return true;
+}
+
+void FMovementProbeScheduler::Invalidate(EMovementProbe Probe)
+{
+	Slots[static_cast<int32>(Probe)].bValid = false;
+}
+
+void FMovementProbeScheduler::ResetStats()
+{
+	for (FProbeSlot& Slot : Slots)
+	{
+		Slot.NumProbes = 0;
+		Slot.NumReuses = 0;
+	}
+}
@@ -48,7 +48,7 @@ bool UCrouchState::Enter(FMovementContext Context)
 {
 	//set character movement component max speed, acceleration, etc.
 	float MoveSpeed = FallbackMoveSpeed;
-	if (AttributeComponent) MoveSpeed = AttributeComponent->GetAttributeValue(AttributeTags::Attribute_Movement_CrouchSpeed);
+	if (AttributeComponent) MoveSpeed = AttributeComponent->GetAttributeValue(EAttributeId::Movement_CrouchSpeed);
 	
 	if (OwnerCharacterMovementComponent) OwnerCharacterMovementComponent->MaxWalkSpeed = MoveSpeed;
 
@@ -4,10 +4,10 @@
 
 #include "Components/CapsuleComponent.h"
 #include "Core/Data/Enums/GameDamageType.h"
-#include "Core/Data/Interfaces/Damageable.h"
 #include "Core/Subsystems/LookTraceSubsystem.h"
 #include "GameFramework/Character.h"
 #include "GameFramework/CharacterMovementComponent.h"
+#include "Systems/AISpawningSystem/EnemyBroadphaseSubsystem.h"
 #include "Systems/MovementSystem/CustomCharacterMovementComponent.h"
 #include "Systems/MovementSystem/MovementFiniteStateMachine.h"
 #include "Systems/MovementSystem/States/RegularVaultState.h"
@@ -38,6 +38,8 @@ void UDashState::Init(float InputFallbackDashSpeed, float InputDashDuration, flo
 	// set LookTraceSubsystem
 	OwnerPawn = MovementFSM->GetOwnerPawn();
 	if (!OwnerPawn) return;
+
+	EnemyBroadphase = OwnerPawn->GetWorld()->GetSubsystem<UEnemyBroadphaseSubsystem>();
 	
 	APlayerController* PlayerController = Cast<APlayerController>(OwnerPawn->GetController());
 	if (!PlayerController) return;
@@ -108,12 +110,13 @@ void UDashState::Tick(float DeltaTime, FMovementContext Context)
 	if (CurrentDashTime < DashDuration) CurrentDashTime += DeltaTime;
 	else FSM->SetState(UWalkState::StaticClass(), Context);
 
-	if (TryVaultTransition(Context)) return; //maybe every 0.05 sec instead?
+	if (TryVaultTransition(Context)) return;
 }
 
 bool UDashState::Exit()
 {
 	StopDash();
+	CustomCharMoveComp->ResetProbe(EMovementProbe::DashVault);
 
 	CharMoveComp->MaxAcceleration = InitialAcceleration;
 	CharMoveComp->BrakingDecelerationFalling = InitialDashFallSpeedInAir;
@@ -141,12 +144,27 @@ bool UDashState::StartDash(FVector2f MoveInput)
 	InitialSpeed = CharMoveComp->GetMaxSpeed();
 
 	float MoveSpeed = FallBackDashSpeed;
-	if (AttributeComponent) MoveSpeed = AttributeComponent->GetAttributeValue(AttributeTags::Attribute_Dash_Strength);
+	if (AttributeComponent) MoveSpeed = AttributeComponent->GetAttributeValue(EAttributeId::Dash_Strength);
 
 	CharMoveComp->MaxWalkSpeed = MoveSpeed;
 
 	CurrentDashTime = 0;
-	DamagedActors.Empty();
+
+	// attribute values for the whole dash
+	FCombatHitParams HitParams;
+	HitParams.DamageType = EGameDamageType::DashHit;
+	HitParams.Damage = FallbackDashHitDamage;
+	HitParams.MaxHits = MaxDashHitCapacity;
+	HitParams.KnockbackForce = FallbackForwardHitKnockbackStrengthForSurvivingEnemies;
+	HitParams.KnockbackUpward = UpwardHitKnockbackStrengthForSurvivingEnemies;
+	HitParams.KnockbackForceDead = FallbackForwardHitKnockbackStrengthForDyingEnemies;
+	if (AttributeComponent)
+	{
+		HitParams.Damage = AttributeComponent->GetAttributeValue(EAttributeId::Dash_CollisionDamage);
+		HitParams.KnockbackForce = AttributeComponent->GetAttributeValue(EAttributeId::Melee_KnockbackForce);
+		HitParams.KnockbackForceDead = AttributeComponent->GetAttributeValue(EAttributeId::Melee_KnockbackForceDead);
+	}
+	HitResolver.BeginSwing(CustomCharMoveComp->GetOwner(), HitParams);
 	
 	return true;
 }
@@ -165,8 +183,10 @@ bool UDashState::StopDash()
 
 bool UDashState::TryVaultTransition(FMovementContext Context)
 {
-	FHitResult Hit = LookTraceSubsystem->GetHitResultFromPawnForwardSphereTrace(
-		OwnerPawn, VaultTraceLength, VaultTraceRadius, VaultCollisionChannel);
+	// scheduled probe: traces ahead and only when the last result no longer covers where the dash is
+	FLookTraceCallerScope TraceCaller(LookTraceSubsystem, TEXT("DashState.Vault"));
+	FHitResult Hit;
+	if (!CustomCharMoveComp->ProbeForward(EMovementProbe::DashVault, VaultTraceLength, VaultTraceRadius, VaultCollisionChannel, false, Hit)) return false;
 
 	AActor* VaultableObject = Hit.GetActor();
 	
@@ -209,75 +229,16 @@ void UDashState::TryDashHit()
 	//check if unlocked from movement comp?
 	
 	if (!LookTraceSubsystem) return;
-	
-	FHitResult Hit = LookTraceSubsystem->GetHitResultFromPawnForwardSphereTraceWithOffset(
-		100, OwnerPawn, VaultTraceLength, VaultTraceRadius, ECollisionChannel::ECC_Camera);
-	
-	AActor* HitActor = Hit.GetActor();
-	if (!HitActor) return;
-	if (HitActor == CustomCharMoveComp->GetOwner()) return;
-	if (!HitActor->GetClass()->ImplementsInterface(UDamageable::StaticClass())) return;
-
-	if (DamagedActors.Contains(HitActor)) return;
 
-	if (DamagedActors.Num() >= MaxDashHitCapacity) return;
-
-	float DashHitDamage = FallbackDashHitDamage;
-	if (AttributeComponent) DashHitDamage = AttributeComponent->GetAttributeValue(AttributeTags::Attribute_Dash_CollisionDamage);
-	
-	IDamageable::Execute_TakeDamage(HitActor, EGameDamageType::DashHit, DashHitDamage, 1.0f, "");
-	if (!HitActor) return;
+	// broadphase: nothing damageable near the dash path, skip the sweep
+	const FVector DashForward = OwnerPawn->GetActorForwardVector();
+	const FVector DashStart = OwnerPawn->GetActorLocation() + DashForward * 100;
+	const FVector DashEnd = OwnerPawn->GetActorLocation() + DashForward * VaultTraceLength;
+	if (EnemyBroadphase && !EnemyBroadphase->MayOverlapTargets(DashStart, DashEnd, VaultTraceRadius, OwnerPawn)) return;
 	
-	DamagedActors.Add(HitActor);
-	
-	//move these to enemy itself
-	KnockbackLiving(HitActor);
-	KnockbackDead(HitActor);
-}
-
-void UDashState::KnockbackLiving(AActor* HitActor)
-{
-	// sigh --> todo: need a way to get the character easily --> do it in the enemies instead
-
-	if (!HitActor) return;
-	ACharacter* Char = Cast<ACharacter>(HitActor);
-	if (Char)
-	{
-		// Direction from attacker -> victim (mostly horizontal)
-		FVector Dir = (Char->GetActorLocation() - CustomCharMoveComp->GetOwner()->GetActorLocation());
-		Dir.Z = 0.f;
-		Dir = Dir.GetSafeNormal();
-
-		
-		float ForwardMeleeKnockbackStrengthForSurvivingEnemies = FallbackForwardHitKnockbackStrengthForSurvivingEnemies;
-		if (AttributeComponent) ForwardMeleeKnockbackStrengthForSurvivingEnemies = AttributeComponent->GetAttributeValue(AttributeTags::Attribute_Melee_KnockbackForce);
-
-		const float HorizontalStrength = ForwardMeleeKnockbackStrengthForSurvivingEnemies;
-		const float VerticalBoost      = UpwardHitKnockbackStrengthForSurvivingEnemies;
-		const FVector LaunchVel = (Dir * HorizontalStrength) + FVector(0,0,VerticalBoost);
-
-		
-		// Add to current velocity (don’t overwrite):
-		const bool bXYOverride = false;
-		const bool bZOverride  = false;
-		Char->LaunchCharacter(LaunchVel, bXYOverride, bZOverride);
-	}
-}
-
-void UDashState::KnockbackDead(AActor* HitActor)
-{
-	if (!HitActor) return;
-	if (!CustomCharMoveComp) return;
-
-	ACharacter* Char = Cast<ACharacter>(HitActor);
-	if (!Char) return;
-	USkeletalMeshComponent* SkeletalMeshComponent = Char->GetMesh();
-	if (!SkeletalMeshComponent) return;
-
-	
-	float ForwardMeleeKnockbackStrengthForDyingEnemies = FallbackForwardHitKnockbackStrengthForDyingEnemies;
-	if (AttributeComponent) ForwardMeleeKnockbackStrengthForDyingEnemies = AttributeComponent->GetAttributeValue(AttributeTags::Attribute_Melee_KnockbackForceDead);
+	FLookTraceCallerScope TraceCaller(LookTraceSubsystem, TEXT("DashState.DashHit"));
+	FHitResult Hit = LookTraceSubsystem->GetHitResultFromPawnForwardSphereTraceWithOffset(
+		100, OwnerPawn, VaultTraceLength, VaultTraceRadius, ECollisionChannel::ECC_Camera, ELookTracePreset::Melee);
 
-	FVector Direction = (HitActor->GetActorLocation() - CustomCharMoveComp->GetOwner()->GetActorLocation()).GetSafeNormal();
-	SkeletalMeshComponent->AddImpulseToAllBodiesBelow(Direction * ForwardMeleeKnockbackStrengthForDyingEnemies, NAME_None, true);
+	HitResolver.ResolveHits(MakeArrayView(&Hit, 1));
 }
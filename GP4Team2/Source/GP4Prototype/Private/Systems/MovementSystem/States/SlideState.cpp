@@ -4,11 +4,11 @@
 
 #include "Components/CapsuleComponent.h"
 #include "Core/Data/Enums/GameDamageType.h"
-#include "Core/Data/Interfaces/Damageable.h"
 #include "Core/Subsystems/LookTraceSubsystem.h"
 #include "GameFramework/Character.h"
 #include "GameFramework/CharacterMovementComponent.h"
 #include "GameFramework/Pawn.h"
+#include "Systems/AISpawningSystem/EnemyBroadphaseSubsystem.h"
 #include "Systems/MovementSystem/CustomCharacterMovementComponent.h"
 #include "Systems/MovementSystem/MovementFiniteStateMachine.h"
 #include "Systems/MovementSystem/States/CrouchState.h"
@@ -62,6 +62,8 @@ void USlideState::Init(float InitFallbackSlideStrength, float InitSlideFrictionL
 	// set LookTraceSubsystem
 	OwnerPawn = MovementFSM->GetOwnerPawn();
 	if (!OwnerPawn) return;
+
+	EnemyBroadphase = OwnerPawn->GetWorld()->GetSubsystem<UEnemyBroadphaseSubsystem>();
     	
 	APlayerController* PlayerController = Cast<APlayerController>(OwnerPawn->GetController());
 	if (!PlayerController) return;
@@ -134,7 +136,7 @@ void USlideState::Tick(float DeltaTime, FMovementContext Context)
 	if (Context.bMeleeSlideUnlocked) TryDashHit();
 
 	float SlideDuration = FallbackSlideDuration;
-	if (AttributeComponent) SlideDuration = AttributeComponent->GetAttributeValue(AttributeTags::Attribute_Slide_Duration);
+	if (AttributeComponent) SlideDuration = AttributeComponent->GetAttributeValue(EAttributeId::Slide_Duration);
 	
 	if (CurrentSlideDuration < SlideDuration) CurrentSlideDuration += DeltaTime;
 	else
@@ -170,12 +172,27 @@ bool USlideState::StartSlide()
 	FVector ResultMoveDir = (ForwardBack).GetSafeNormal();
 
 	float SlideStrength = FallbackSlideStrength;
-	if (AttributeComponent) SlideStrength = AttributeComponent->GetAttributeValue(AttributeTags::Attribute_Slide_Strength);
+	if (AttributeComponent) SlideStrength = AttributeComponent->GetAttributeValue(EAttributeId::Slide_Strength);
 	
 	OwnerCharacterMovementComponent->Launch(ResultMoveDir * SlideStrength);
 
 	CurrentSlideDuration = 0;
-	DamagedActors.Empty();
+
+	// attribute values for the whole slide
+	FCombatHitParams HitParams;
+	HitParams.DamageType = EGameDamageType::SlideHit;
+	HitParams.Damage = FallbackSlideHitDamage;
+	HitParams.MaxHits = MaxDashHitCapacity;
+	HitParams.KnockbackForce = FallbackForwardHitKnockbackStrengthForSurvivingEnemies;
+	HitParams.KnockbackUpward = UpwardHitKnockbackStrengthForSurvivingEnemies;
+	HitParams.KnockbackForceDead = FallbackForwardHitKnockbackStrengthForDyingEnemies;
+	if (AttributeComponent)
+	{
+		HitParams.Damage = AttributeComponent->GetAttributeValue(EAttributeId::Slide_CollisionDamage);
+		HitParams.KnockbackForce = AttributeComponent->GetAttributeValue(EAttributeId::Melee_KnockbackForce);
+		HitParams.KnockbackForceDead = AttributeComponent->GetAttributeValue(EAttributeId::Melee_KnockbackForceDead);
+	}
+	HitResolver.BeginSwing(CustomCharMoveComp->GetOwner(), HitParams);
 
 	return true;
 }
@@ -193,76 +210,16 @@ void USlideState::TryDashHit()
 	//check if unlocked from movement comp?
 	
 	if (!LookTraceSubsystem) return;
-	
-	FHitResult Hit = LookTraceSubsystem->GetHitResultFromPawnForwardSphereTraceWithOffset(
-		100, OwnerPawn, VaultTraceLength, VaultTraceRadius, ECollisionChannel::ECC_Camera);
-	
-	AActor* HitActor = Hit.GetActor();
-	if (!HitActor) return;
-	if (HitActor == CustomCharMoveComp->GetOwner()) return;
-	if (!HitActor->GetClass()->ImplementsInterface(UDamageable::StaticClass())) return;
-
-	if (DamagedActors.Contains(HitActor)) return;
 
-	if (DamagedActors.Num() >= MaxDashHitCapacity) return;
-
-
-	float SladeHitDamage = FallbackSlideHitDamage;
-	if (AttributeComponent) SladeHitDamage = AttributeComponent->GetAttributeValue(AttributeTags::Attribute_Slide_CollisionDamage);
-	
-	IDamageable::Execute_TakeDamage(HitActor, EGameDamageType::SlideHit, SladeHitDamage, 1.0f, "");
-	if (!HitActor) return;
-	
-	DamagedActors.Add(HitActor);
+	// broadphase: nothing damageable near the dash path, skip the sweep
+	const FVector DashForward = OwnerPawn->GetActorForwardVector();
+	const FVector DashStart = OwnerPawn->GetActorLocation() + DashForward * 100;
+	const FVector DashEnd = OwnerPawn->GetActorLocation() + DashForward * VaultTraceLength;
+	if (EnemyBroadphase && !EnemyBroadphase->MayOverlapTargets(DashStart, DashEnd, VaultTraceRadius, OwnerPawn)) return;
 	
-	//move these to enemy itself
-	KnockbackLiving(HitActor);
-	KnockbackDead(HitActor);
-}
-
-void USlideState::KnockbackLiving(AActor* HitActor)
-{
-	// sigh --> todo: need a way to get the character easily --> do it in the enemies instead
+	FLookTraceCallerScope TraceCaller(LookTraceSubsystem, TEXT("SlideState.DashHit"));
+	FHitResult Hit = LookTraceSubsystem->GetHitResultFromPawnForwardSphereTraceWithOffset(
+		100, OwnerPawn, VaultTraceLength, VaultTraceRadius, ECollisionChannel::ECC_Camera, ELookTracePreset::Melee);
 
-	if (!HitActor) return;
-	ACharacter* Char = Cast<ACharacter>(HitActor);
-	if (Char)
-	{
-		// Direction from attacker -> victim (mostly horizontal)
-		FVector Dir = (Char->GetActorLocation() - CustomCharMoveComp->GetOwner()->GetActorLocation());
-		Dir.Z = 0.f;
-		Dir = Dir.GetSafeNormal();
-		
-		
-		float ForwardMeleeKnockbackStrengthForSurvivingEnemies = FallbackForwardHitKnockbackStrengthForSurvivingEnemies;
-		if (AttributeComponent) ForwardMeleeKnockbackStrengthForSurvivingEnemies = AttributeComponent->GetAttributeValue(AttributeTags::Attribute_Melee_KnockbackForce);
-		
-		const float HorizontalStrength = ForwardMeleeKnockbackStrengthForSurvivingEnemies;
-		const float VerticalBoost      = UpwardHitKnockbackStrengthForSurvivingEnemies;
-		const FVector LaunchVel = (Dir * HorizontalStrength) + FVector(0,0,VerticalBoost);
-		
-		
-		// Add to current velocity (don’t overwrite):
-		const bool bXYOverride = false;
-		const bool bZOverride  = false;
-		Char->LaunchCharacter(LaunchVel, bXYOverride, bZOverride);
-	}
+	HitResolver.ResolveHits(MakeArrayView(&Hit, 1));
 }
-
-void USlideState::KnockbackDead(AActor* HitActor)
-{
-	if (!HitActor) return;
-	if (!CustomCharMoveComp) return;
-
-	ACharacter* Char = Cast<ACharacter>(HitActor);
-	if (!Char) return;
-	USkeletalMeshComponent* SkeletalMeshComponent = Char->GetMesh();
-	if (!SkeletalMeshComponent) return;
-
-	
-	float ForwardMeleeKnockbackStrengthForDyingEnemies = FallbackForwardHitKnockbackStrengthForDyingEnemies;
-	if (AttributeComponent) ForwardMeleeKnockbackStrengthForDyingEnemies = AttributeComponent->GetAttributeValue(AttributeTags::Attribute_Melee_KnockbackForceDead);
-
-	FVector Direction = (HitActor->GetActorLocation() - CustomCharMoveComp->GetOwner()->GetActorLocation()).GetSafeNormal();
-	SkeletalMeshComponent->AddImpulseToAllBodiesBelow(Direction * ForwardMeleeKnockbackStrengthForDyingEnemies, NAME_None, true);
-}
\ No newline at end of file
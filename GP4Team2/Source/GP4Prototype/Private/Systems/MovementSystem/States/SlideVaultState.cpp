@@ -154,8 +154,9 @@ bool USlideVaultState::StopSlide()
 
 bool USlideVaultState::TryWalkTransition(FMovementContext Context)
 {
+	FLookTraceCallerScope TraceCaller(LookTraceSubsystem, TEXT("SlideVaultState.Ground"));
 	FHitResult Hit = LookTraceSubsystem->GetHitResultFromPawnDownSphereTrace(
-		OwnerPawn, 1000, 10, VaultTraceChannel);
+		OwnerPawn, 1000, 10, VaultTraceChannel, ELookTracePreset::GroundProbe);
 
 	if (!Hit.GetActor())
 	{
@@ -64,7 +64,7 @@ bool USprintState::Enter(FMovementContext Context)
 	//set character movement component max speed, acceleration, etc.
 	
 	float MoveSpeed = FallbackMoveSpeed;
-	if (AttributeComponent) MoveSpeed = AttributeComponent->GetAttributeValue(AttributeTags::Attribute_Movement_SprintSpeed);
+	if (AttributeComponent) MoveSpeed = AttributeComponent->GetAttributeValue(EAttributeId::Movement_SprintSpeed);
 	
 	if (OwnerCharacterMovementComponent) OwnerCharacterMovementComponent->MaxWalkSpeed = MoveSpeed;
 
@@ -79,7 +79,7 @@ void USprintState::Tick(float DeltaTime, FMovementContext Context)
 	
 	Move(Context.MoveInput);
 
-	if (TryVaultTransition(Context)) return; //maybe every 0.05 sec instead?
+	if (TryVaultTransition(Context)) return;
 	if (!Context.bWantsToSprint) FSM->SetState(UWalkState::StaticClass(), Context);
 	if (Context.bWantsToCrouch && !OwnerCharacterMovementComponent->IsFalling()) FSM->SetState(USlideState::StaticClass(), Context);
 	if (Context.bWantsToDash) FSM->SetState(UDashState::StaticClass(), Context);
@@ -87,6 +87,8 @@ void USprintState::Tick(float DeltaTime, FMovementContext Context)
 
 bool USprintState::Exit()
 {
+	CustomCharMoveComp->ResetProbe(EMovementProbe::SprintVault);
+
 	CustomCharMoveComp->OnSprintFinish.Broadcast();
 	
 	return Super::Exit();
@@ -105,8 +107,12 @@ void USprintState::Move(FVector2f MoveInput)
 
 bool USprintState::TryVaultTransition(FMovementContext Context)
 {
-	FHitResult Hit = LookTraceSubsystem->GetHitResultFromPawnForwardSphereTrace(
-		OwnerPawn, VaultTraceLength, VaultTraceRadius, VaultTraceChannel);
+	if (!LookTraceSubsystem || !CustomCharMoveComp) return false;
+
+	// Async scheduled probe: traces ahead of the sprint, so one frame of latency never delays the vault
+	FLookTraceCallerScope TraceCaller(LookTraceSubsystem, TEXT("SprintState.Vault"));
+	FHitResult Hit;
+	if (!CustomCharMoveComp->ProbeForward(EMovementProbe::SprintVault, VaultTraceLength, VaultTraceRadius, VaultTraceChannel, true, Hit)) return false;
 
 	AActor* VaultableObject = Hit.GetActor();
 	
@@ -30,7 +30,7 @@ bool UWalkState::Enter(FMovementContext Context)
 	//set character movement component max speed, acceleration, etc.
 	
 	float MoveSpeed = FallbackMoveSpeed;
-	if (AttributeComponent) MoveSpeed = AttributeComponent->GetAttributeValue(AttributeTags::Attribute_Movement_WalkSpeed);
+	if (AttributeComponent) MoveSpeed = AttributeComponent->GetAttributeValue(EAttributeId::Movement_WalkSpeed);
 	
 	if (OwnerCharacterMovementComponent) OwnerCharacterMovementComponent->MaxWalkSpeed = MoveSpeed;
 
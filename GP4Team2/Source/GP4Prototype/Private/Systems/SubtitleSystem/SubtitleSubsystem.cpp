@@ -283,6 +283,16 @@ void USubtitleSubsystem::StartExpiryTimer(USubtitleEntryWidget* Entry, float Dur
 	if (!Entry) return;
 	if (UWorld* World = GetWorld())
 	{
+		// Entries are pooled: a culled entry can come back before its old timer fired, so drop that tracking first
+		for (int32 i = ActiveSubtitles.Num() - 1; i >= 0; --i)
+		{
+			if (ActiveSubtitles[i].Entry == Entry)
+			{
+				World->GetTimerManager().ClearTimer(ActiveSubtitles[i].TimerHandle);
+				ActiveSubtitles.RemoveAtSwap(i);
+			}
+		}
+
 		const int32 TimerId = NextTimerId++;
 		FActiveSubtitle Active;
 		Active.Entry = Entry;
@@ -250,10 +250,13 @@ void UUpgradeManagerComponent::ApplyCardToAttributes(UAttributeComponent* Attrib
         ModsByTag.FindOrAdd(E.TargetAttribute).Add(E);
     }
 
+    // One recalculation and one value-change event per attribute, however many rows the card has
+    AttributeComp->BeginBatch();
     for (const auto& KVP : ModsByTag)
     {
         EnforceCapsAndApplyForTag(AttributeComp, Card, KVP.Key, KVP.Value, Scale);
     }
+    AttributeComp->EndBatch();
 }
 
 void UUpgradeManagerComponent::RemoveCardFromAttributes(UAttributeComponent* AttributeComp, UUpgradeCardData* Card) const
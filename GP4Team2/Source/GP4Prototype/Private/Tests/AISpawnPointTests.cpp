@@ -0,0 +1,50 @@
+﻿// AISpawnPointTests.cpp - Automation tests for the spawn point location pool
+
+#include "Misc/AutomationTest.h"
+#include "Tests/TestWorldHelpers.h"
+#include "Engine/World.h"
+#include "Components/SceneComponent.h"
+#include "Systems/AISpawningSystem/AISpawnPoint.h"
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FAISpawnPointPoolTest, "GP4.AISpawning.SpawnPoint.LocationPool", EAutomationTestFlags::EditorContext | EAutomationTestFlags::EngineFilter)
+bool FAISpawnPointPoolTest::RunTest(const FString& Parameters)
+{
+	// The test world has no navmesh, so every build comes out empty
+	AddExpectedMessage(TEXT("spawn location pool is empty"), ELogVerbosity::Warning, EAutomationExpectedMessageFlags::Contains, 0);
+
+	UWorld* World = GP4TestWorld::Create(TEXT("AISpawnPointTestWorld"));
+	{
+		AAISpawnPoint* SpawnPoint = World->SpawnActor<AAISpawnPoint>();
+		TestNotNull(TEXT("Spawn point spawned"), SpawnPoint);
+		if (SpawnPoint)
+		{
+			TestEqual(TEXT("BeginPlay samples the empty pool once"), SpawnPoint->GetSpawnPoolBuildCount(), 1);
+			TestTrue(TEXT("Nothing to sample without a navmesh"), SpawnPoint->RelativeSpawnLocationPool.IsEmpty());
+
+			FVector Location;
+			TestFalse(TEXT("Empty pool draws nothing"), SpawnPoint->DrawSpawnLocation(Location));
+			TestFalse(TEXT("Repeated draws stay empty"), SpawnPoint->DrawSpawnLocation(Location));
+			TestEqual(TEXT("Empty pool is not re-sampled inside the retry interval"), SpawnPoint->GetSpawnPoolBuildCount(), 1);
+
+			SpawnPoint->SpawnPoolRetryInterval = 0.f;
+			SpawnPoint->BuildSpawnLocationPool();
+			TestFalse(TEXT("Draw after the retry interval still finds nothing"), SpawnPoint->DrawSpawnLocation(Location));
+			TestEqual(TEXT("Draw after the retry interval re-samples"), SpawnPoint->GetSpawnPoolBuildCount(), 3);
+
+			// A baked pool is stored relative to the spawner, so moving it (level instancing, streaming offset) moves the draws
+			// The native class has no root (blueprints add one), so give it something to move
+			USceneComponent* Root = NewObject<USceneComponent>(SpawnPoint);
+			SpawnPoint->SetRootComponent(Root);
+			Root->RegisterComponent();
+
+			SpawnPoint->RelativeSpawnLocationPool = { FVector(100.f, 0.f, 0.f) };
+			SpawnPoint->SetActorLocationAndRotation(FVector(500.f, 0.f, 0.f), FRotator(0.f, 90.f, 0.f));
+			TestTrue(TEXT("Baked pool draws a location"), SpawnPoint->DrawSpawnLocation(Location));
+			TestTrue(TEXT("Drawn location follows the spawner transform"), Location.Equals(FVector(500.f, 100.f, 0.f), 0.01f));
+			TestTrue(TEXT("Single-entry pool repeats after the bag runs out"), SpawnPoint->DrawSpawnLocation(Location) && Location.Equals(FVector(500.f, 100.f, 0.f), 0.01f));
+			TestEqual(TEXT("Filled pool is never re-sampled on draw"), SpawnPoint->GetSpawnPoolBuildCount(), 3);
+		}
+	}
+	GP4TestWorld::Destroy(World);
+	return true;
+}
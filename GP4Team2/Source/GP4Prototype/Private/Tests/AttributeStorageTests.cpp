@@ -0,0 +1,256 @@
+﻿// AttributeStorageTests.cpp - Automation tests and benchmarks for dense attribute storage
+
+#include "Misc/AutomationTest.h"
+#include "Systems/AttributeSystem/AgentData.h"
+#include "Systems/AttributeSystem/AttributeComponent.h"
+#include "Systems/AttributeSystem/AttributeTags.h"
+
+namespace AttributeStorageTests
+{
+	constexpr int32 NumNative = static_cast<int32>(EAttributeId::NumNative);
+
+	// The per-frame reads the movement and combat components do, as indices
+	const EAttributeId HotIds[] = {
+		EAttributeId::Dash_CooldownPerCharge,
+		EAttributeId::Dash_MaxCharges,
+		EAttributeId::Slide_Cooldown,
+		EAttributeId::Weapon_FireDelay,
+		EAttributeId::Melee_Damage,
+		EAttributeId::MaxHealth,
+	};
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FAttributeStorageIndexMatchesTagTest, "GP4.Attribute.Storage.IndexMatchesTag", EAutomationTestFlags::EditorContext | EAutomationTestFlags::EngineFilter)
+bool FAttributeStorageIndexMatchesTagTest::RunTest(const FString& Parameters)
+{
+	using namespace AttributeStorageTests;
+
+	UAttributeComponent* Comp = NewObject<UAttributeComponent>(GetTransientPackage());
+	for (int32 Index = 0; Index < NumNative; ++Index)
+	{
+		const EAttributeId Id = static_cast<EAttributeId>(Index);
+		const FGameplayTag Tag = AttributeTags::GetNativeTag(Id);
+		TestEqual(TEXT("Native tag resolves to its own index"), AttributeTags::FindNativeIndex(Tag), Index);
+		TestTrue(TEXT("Native attributes are registered up front"), Comp->HasAttribute(Tag));
+
+		Comp->SetAttributeBaseValue(Tag, 10.f + Index);
+		FModifier Mul; Mul.Type = EModificationType::Multiplication; Mul.Value = 2.f;
+		Comp->AddModifier(Tag, Mul);
+		TestEqual(TEXT("Indexed value matches tag value"), Comp->GetAttributeValue(Id), Comp->GetAttributeValue(Tag));
+		TestEqual(TEXT("Indexed base matches tag base"), Comp->GetAttributeBaseValue(Id), 10.f + Index);
+	}
+
+	// Non-native tags are appended after the native range and keep working through the tag API
+	Comp->RegisterAndGetAttribute(TEXT("Attribute.Test"), TEXT("Test attribute"));
+	const FGameplayTag ExtraTag = FGameplayTag::RequestGameplayTag(FName(TEXT("Attribute.Test")));
+	TestEqual(TEXT("Extra tag is outside the native table"), AttributeTags::FindNativeIndex(ExtraTag), static_cast<int32>(INDEX_NONE));
+	Comp->SetAttributeBaseValue(ExtraTag, 4.f);
+	TestEqual(TEXT("Extra tag value"), Comp->GetAttributeValue(ExtraTag), 4.f);
+	TestEqual(TEXT("Extra record is the stored one"), Comp->GetAttribute(ExtraTag).BaseValue, 4.f);
+	TestEqual(TEXT("Native values survive appending"), Comp->GetAttributeValue(EAttributeId::MaxHealth), 20.f);
+
+	const TMap<FGameplayTag, FAttribute> AllAttributes = Comp->GetAttributes();
+	TestEqual(TEXT("Map view lists natives and extras"), AllAttributes.Num(), NumNative + 1);
+	const FAttribute* MapExtra = AllAttributes.Find(ExtraTag);
+	TestTrue(TEXT("Map view carries the stored record"), MapExtra && MapExtra->BaseValue == 4.f);
+	return true;
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FAttributeStorageLookupBenchmark, "GP4.Attribute.Benchmark.IndexedVsMapLookup", EAutomationTestFlags::EditorContext | EAutomationTestFlags::PerfFilter)
+bool FAttributeStorageLookupBenchmark::RunTest(const FString& Parameters)
+{
+	using namespace AttributeStorageTests;
+	constexpr int32 Iterations = 1000000;
+
+	UAttributeComponent* Comp = NewObject<UAttributeComponent>(GetTransientPackage());
+
+	// The previous storage layout, filled with the same attributes
+	TMap<FGameplayTag, FAttribute> Map;
+	for (int32 Index = 0; Index < NumNative; ++Index)
+	{
+		const FGameplayTag Tag = AttributeTags::GetNativeTag(static_cast<EAttributeId>(Index));
+		Comp->SetAttributeBaseValue(Tag, 1.f + Index);
+		FAttribute& Attr = Map.Add(Tag);
+		Attr.BaseValue = Attr.Value = 1.f + Index;
+	}
+
+	FGameplayTag HotTags[UE_ARRAY_COUNT(HotIds)];
+	for (int32 i = 0; i < UE_ARRAY_COUNT(HotIds); ++i)
+	{
+		HotTags[i] = AttributeTags::GetNativeTag(HotIds[i]);
+	}
+
+	// Sums keep the reads from being optimized away and double as a correctness check
+	auto Measure = [&](const TCHAR* Label, auto&& Read) -> double
+	{
+		float Sum = 0.f;
+		const double Start = FPlatformTime::Seconds();
+		for (int32 i = 0; i < Iterations; ++i)
+		{
+			Sum += Read(i % UE_ARRAY_COUNT(HotIds));
+		}
+		const double Elapsed = FMath::Max(FPlatformTime::Seconds() - Start, UE_DOUBLE_SMALL_NUMBER);
+		const double PerSecond = Iterations / Elapsed;
+		AddInfo(FString::Printf(TEXT("%s %.1f M lookups/s (sum %.0f)"), Label, PerSecond / 1e6, Sum));
+		return PerSecond;
+	};
+
+	const double MapRate = Measure(TEXT("TMap by tag:  "), [&](int32 i)
+	{
+		const FAttribute* Attr = Map.Find(HotTags[i]);
+		return Attr ? Attr->Value : 0.f;
+	});
+	const double TagRate = Measure(TEXT("Store by tag: "), [&](int32 i) { return Comp->GetAttributeValue(HotTags[i]); });
+	const double IndexRate = Measure(TEXT("Store by index:"), [&](int32 i) { return Comp->GetAttributeValue(HotIds[i]); });
+
+	AddInfo(FString::Printf(TEXT("Indexed reads are %.1fx the map, tag reads %.1fx"), IndexRate / MapRate, TagRate / MapRate));
+	TestTrue(TEXT("Indexed reads are faster than map lookups"), IndexRate > MapRate);
+	return true;
+}
+
+namespace AttributeStorageTests
+{
+	UAgentData* CreateAgentData()
+	{
+		UAgentData* Data = NewObject<UAgentData>(GetTransientPackage());
+		FAgentAttribute& Health = Data->Attributes.AddDefaulted_GetRef();
+		Health.AttributeTag = AttributeTags::Attribute_MaxHealth;
+		Health.BaseValue = 100.f;
+		FAgentAttribute& Charges = Data->Attributes.AddDefaulted_GetRef();
+		Charges.AttributeTag = AttributeTags::Attribute_Dash_MaxCharges;
+		Charges.BaseValue = 2.4f;
+		Charges.NumericType = EAttributeNumericType::Integer;
+		FAgentAttribute& Speed = Data->Attributes.AddDefaulted_GetRef();
+		Speed.AttributeTag = AttributeTags::Attribute_Movement_WalkSpeed;
+		Speed.BaseValue = 600.f;
+		Speed.ClampMode = EAttributeClampMode::Max;
+		Speed.ClampValue = 500.f;
+		return Data;
+	}
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FAttributeStorageSharedTemplateTest, "GP4.Attribute.Storage.SharedTemplateCopyOnWrite", EAutomationTestFlags::EditorContext | EAutomationTestFlags::EngineFilter)
+bool FAttributeStorageSharedTemplateTest::RunTest(const FString& Parameters)
+{
+	UAgentData* Data = AttributeStorageTests::CreateAgentData();
+	UAttributeComponent* A = NewObject<UAttributeComponent>(GetTransientPackage());
+	UAttributeComponent* B = NewObject<UAttributeComponent>(GetTransientPackage());
+	A->InitializeFromAgentData(Data);
+	B->InitializeFromAgentData(Data);
+
+	TestTrue(TEXT("Components share one baked template"), &A->GetAttributeStore().GetTemplate().Get() == &B->GetAttributeStore().GetTemplate().Get());
+	TestTrue(TEXT("Unmodified component owns no attribute data"), A->GetAttributeStore().GetOverlayAllocatedSize() == 0);
+	TestEqual(TEXT("Template base value"), A->GetAttributeValue(EAttributeId::MaxHealth), 100.f);
+	TestEqual(TEXT("Template rounds integers"), A->GetAttributeValue(EAttributeId::Dash_MaxCharges), 2.f);
+	TestEqual(TEXT("Template applies clamps"), A->GetAttributeValue(EAttributeId::Movement_WalkSpeed), 500.f);
+
+	FModifier Add; Add.Type = EModificationType::Addition; Add.Value = 50.f;
+	A->AddModifier(AttributeTags::Attribute_MaxHealth, Add);
+	TestEqual(TEXT("Modified component sees its modifier"), A->GetAttributeValue(EAttributeId::MaxHealth), 150.f);
+	TestEqual(TEXT("Sibling keeps the template value"), B->GetAttributeValue(EAttributeId::MaxHealth), 100.f);
+	TestTrue(TEXT("Modified component allocated an overlay"), A->GetAttributeStore().HasOverlay());
+	TestFalse(TEXT("Sibling still has no overlay"), B->GetAttributeStore().HasOverlay());
+	TestEqual(TEXT("Untouched records still read from the template"), A->GetAttributeValue(EAttributeId::Dash_MaxCharges), 2.f);
+
+	A->RemoveModifierByID(AttributeTags::Attribute_MaxHealth, A->GetAttribute(AttributeTags::Attribute_MaxHealth).ActiveModifiers[0].ModifierID);
+	TestEqual(TEXT("Removing the modifier restores the value"), A->GetAttributeValue(EAttributeId::MaxHealth), 100.f);
+	return true;
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FAttributeStorageSpawnBenchmark, "GP4.Attribute.Benchmark.SharedTemplateSpawn", EAutomationTestFlags::EditorContext | EAutomationTestFlags::PerfFilter)
+bool FAttributeStorageSpawnBenchmark::RunTest(const FString& Parameters)
+{
+	constexpr int32 Enemies = 1000;
+	UAgentData* Data = AttributeStorageTests::CreateAgentData();
+	Data->GetAttributeTemplate();
+
+	auto Spawn = [&](bool bForceOverlay, SIZE_T& OutBytes) -> double
+	{
+		TArray<UAttributeComponent*> Comps;
+		for (int32 i = 0; i < Enemies; ++i)
+		{
+			UAttributeComponent* Comp = NewObject<UAttributeComponent>(GetTransientPackage());
+			if (bForceOverlay)
+			{
+				// Any per-instance write makes init copy entries the way every component used to
+				Comp->SetAttributeBaseValue(AttributeTags::Attribute_MaxDefense, 1.f);
+			}
+			Comps.Add(Comp);
+		}
+
+		const double Start = FPlatformTime::Seconds();
+		for (UAttributeComponent* Comp : Comps)
+		{
+			Comp->InitializeFromAgentData(Data);
+		}
+		const double Ms = (FPlatformTime::Seconds() - Start) * 1000.0;
+
+		OutBytes = 0;
+		for (const UAttributeComponent* Comp : Comps)
+		{
+			OutBytes += Comp->GetAttributeStore().GetOverlayAllocatedSize();
+		}
+		return Ms;
+	};
+
+	SIZE_T SharedBytes = 0;
+	SIZE_T CopiedBytes = 0;
+	const double SharedMs = Spawn(false, SharedBytes);
+	const double CopiedMs = Spawn(true, CopiedBytes);
+
+	AddInfo(FString::Printf(TEXT("Shared template: %.3f ms, %llu overlay bytes for %d enemies"), SharedMs, static_cast<uint64>(SharedBytes), Enemies));
+	AddInfo(FString::Printf(TEXT("Per-instance:    %.3f ms, %llu overlay bytes for %d enemies"), CopiedMs, static_cast<uint64>(CopiedBytes), Enemies));
+	TestTrue(TEXT("Shared enemies own no attribute data"), SharedBytes == 0);
+	return true;
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FAttributeStorageBakeTest, "GP4.Attribute.Storage.BakedAgentData", EAutomationTestFlags::EditorContext | EAutomationTestFlags::EngineFilter)
+bool FAttributeStorageBakeTest::RunTest(const FString& Parameters)
+{
+	UAgentData* Data = AttributeStorageTests::CreateAgentData();
+	FAgentAttribute& Untagged = Data->Attributes.AddDefaulted_GetRef();
+	Untagged.BaseValue = 7.f;
+	FAgentAttribute& Duplicate = Data->Attributes.AddDefaulted_GetRef();
+	Duplicate.AttributeTag = AttributeTags::Attribute_MaxHealth;
+	Duplicate.BaseValue = 120.f;
+	Data->BakeAttributes();
+
+	const TSharedRef<const FAttributeTemplate> Template = Data->GetAttributeTemplate();
+	TestEqual(TEXT("Untagged and duplicate entries are dropped"), Template->DataSlots.Num(), 3);
+	TestTrue(TEXT("Natives are laid out in index order"), Template->DataSlots.IsSorted());
+	TestEqual(TEXT("Last duplicate wins"), Template->Values[static_cast<int32>(EAttributeId::MaxHealth)], 120.f);
+	TestEqual(TEXT("Integer base is pre-rounded"), Template->BaseValues[static_cast<int32>(EAttributeId::Dash_MaxCharges)], 2.f);
+	TestEqual(TEXT("Clamp is pre-applied"), Template->Values[static_cast<int32>(EAttributeId::Movement_WalkSpeed)], 500.f);
+
+	UAttributeComponent* Comp = NewObject<UAttributeComponent>(GetTransientPackage());
+	Comp->InitializeFromAgentData(Data);
+	TestTrue(TEXT("Initialized component reads the baked template"), &Comp->GetAttributeStore().GetTemplate().Get() == &Template.Get());
+	TestEqual(TEXT("Component sees the baked value"), Comp->GetAttributeValue(EAttributeId::MaxHealth), 120.f);
+	return true;
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FAttributeStorageReinitTest, "GP4.Attribute.Storage.ReinitKeepsUnsetAttributes", EAutomationTestFlags::EditorContext | EAutomationTestFlags::EngineFilter)
+bool FAttributeStorageReinitTest::RunTest(const FString& Parameters)
+{
+	UAgentData* Full = AttributeStorageTests::CreateAgentData();
+	UAgentData* HealthOnly = NewObject<UAgentData>(GetTransientPackage());
+	FAgentAttribute& Health = HealthOnly->Attributes.AddDefaulted_GetRef();
+	Health.AttributeTag = AttributeTags::Attribute_MaxHealth;
+	Health.BaseValue = 80.f;
+
+	// Data that leaves attributes out must not reset them, same as before templates were shared
+	UAttributeComponent* Comp = NewObject<UAttributeComponent>(GetTransientPackage());
+	Comp->InitializeFromAgentData(Full);
+	Comp->InitializeFromAgentData(HealthOnly);
+	TestEqual(TEXT("Re-initialized attribute takes the new value"), Comp->GetAttributeValue(EAttributeId::MaxHealth), 80.f);
+	TestEqual(TEXT("Attribute missing from the new data keeps its value"), Comp->GetAttributeValue(EAttributeId::Movement_WalkSpeed), 500.f);
+	TestEqual(TEXT("Integer attribute missing from the new data keeps its value"), Comp->GetAttributeValue(EAttributeId::Dash_MaxCharges), 2.f);
+
+	// Data covering everything the previous data set can still be shared
+	UAttributeComponent* Shared = NewObject<UAttributeComponent>(GetTransientPackage());
+	Shared->InitializeFromAgentData(HealthOnly);
+	Shared->InitializeFromAgentData(Full);
+	TestTrue(TEXT("Superset data is shared"), &Shared->GetAttributeStore().GetTemplate().Get() == &Full->GetAttributeTemplate().Get());
+	TestEqual(TEXT("Shared superset value"), Shared->GetAttributeValue(EAttributeId::MaxHealth), 100.f);
+	return true;
+}
@@ -0,0 +1,40 @@
+#pragma once
+
+#include "CoreMinimal.h"
+#include "GameFramework/Actor.h"
+#include "Core/Data/Interfaces/Damageable.h"
+#include "CombatHitResolverTestTarget.generated.h"
+
+class USkeletalMeshComponent;
+
+// Damageable stand-in for the hit resolver and projectile tests: counts hits, keeps the last damage and OnHit payload,
+// and can die on the first one
+UCLASS(NotBlueprintable, NotPlaceable, HideDropdown)
+class ACombatHitResolverTestTarget : public AActor, public IDamageable
+{
+	GENERATED_BODY()
+
+public:
+	ACombatHitResolverTestTarget();
+
+	virtual void TakeDamage_Implementation(EGameDamageType DamageType, float DamageValue, float DamageMultiplier, FName HitSocketName) override;
+
+	// Bindable to ABullet::OnHit / UProjectileSimulationSubsystem::OnProjectileHit
+	UFUNCTION()
+	void RecordHitEvent(AActor* HitActor, float Damage, FName HitSocketName, UPrimitiveComponent* OverlappedComp,
+						UPrimitiveComponent* OtherComp, int32 OtherBodyIndex, bool bFromSweep, const FHitResult& SweepResult);
+
+	UPROPERTY()
+	TObjectPtr<USkeletalMeshComponent> DamageableMesh;
+
+	int32 DamageTaken = 0;
+	float LastDamageValue = 0.f;
+
+	int32 HitEvents = 0;
+	AActor* LastHitActor = nullptr;
+	UPrimitiveComponent* LastOverlappedComp = nullptr;
+	UPrimitiveComponent* LastOtherComp = nullptr;
+	float LastHitEventDamage = 0.f;
+	bool bLastHitFromSweep = false;
+	bool bDestroyOnDamage = false;
+};
@@ -0,0 +1,132 @@
+﻿// CombatHitResolverTests.cpp - Automation tests for the shared melee/dash/slide hit pipeline
+
+#include "Misc/AutomationTest.h"
+#include "Tests/TestWorldHelpers.h"
+#include "Engine/World.h"
+#include "Components/SkeletalMeshComponent.h"
+#include "Systems/CombatSystem/Misc/CombatHitResolver.h"
+#include "Tests/CombatHitResolverTestTarget.h"
+
+ACombatHitResolverTestTarget::ACombatHitResolverTestTarget()
+{
+	DamageableMesh = CreateDefaultSubobject<USkeletalMeshComponent>(TEXT("DamageableMesh"));
+	DamageableMesh->ComponentTags.Add(TEXT("DamageableSkelMesh"));
+	RootComponent = DamageableMesh;
+}
+
+void ACombatHitResolverTestTarget::TakeDamage_Implementation(EGameDamageType DamageType, float DamageValue, float DamageMultiplier, FName HitSocketName)
+{
+	++DamageTaken;
+	LastDamageValue = DamageValue;
+	if (bDestroyOnDamage) Destroy();
+}
+
+void ACombatHitResolverTestTarget::RecordHitEvent(AActor* HitActor, float Damage, FName HitSocketName, UPrimitiveComponent* OverlappedComp,
+	UPrimitiveComponent* OtherComp, int32 OtherBodyIndex, bool bFromSweep, const FHitResult& SweepResult)
+{
+	++HitEvents;
+	LastHitActor = HitActor;
+	LastOverlappedComp = OverlappedComp;
+	LastOtherComp = OtherComp;
+	LastHitEventDamage = Damage;
+	bLastHitFromSweep = bFromSweep;
+}
+
+namespace CombatHitResolverTests
+{
+	FHitResult MakeHit(AActor* Actor)
+	{
+		return FHitResult(Actor, nullptr, Actor->GetActorLocation(), FVector::UpVector);
+	}
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FCombatHitResolverDedupTest, "GP4.Combat.HitResolver.DedupAndCapacity", EAutomationTestFlags::EditorContext | EAutomationTestFlags::EngineFilter)
+bool FCombatHitResolverDedupTest::RunTest(const FString& Parameters)
+{
+	using namespace CombatHitResolverTests;
+
+	UWorld* World = GP4TestWorld::Create(TEXT("CombatHitResolverTestWorld"));
+	{
+		ACombatHitResolverTestTarget* Attacker = World->SpawnActor<ACombatHitResolverTestTarget>();
+		ACombatHitResolverTestTarget* A = World->SpawnActor<ACombatHitResolverTestTarget>();
+		ACombatHitResolverTestTarget* B = World->SpawnActor<ACombatHitResolverTestTarget>();
+		ACombatHitResolverTestTarget* C = World->SpawnActor<ACombatHitResolverTestTarget>();
+		AActor* Wall = World->SpawnActor<AActor>();
+
+		FCombatHitParams Params;
+		Params.MaxHits = 2;
+		FCombatHitResolver Resolver;
+		Resolver.BeginSwing(Attacker, Params);
+
+		// two components of A, the attacker itself and a non-damageable wall in one sweep
+		const TArray<FHitResult> Sweep = { MakeHit(A), MakeHit(A), MakeHit(Attacker), MakeHit(Wall), MakeHit(B), MakeHit(C) };
+		TestEqual(TEXT("Capacity stops the swing at MaxHits"), Resolver.ResolveHits(Sweep), 2);
+		TestEqual(TEXT("Multi-component hit damages once"), A->DamageTaken, 1);
+		TestEqual(TEXT("Second victim is damaged"), B->DamageTaken, 1);
+		TestEqual(TEXT("Victim past capacity is untouched"), C->DamageTaken, 0);
+		TestEqual(TEXT("Attacker never hits itself"), Attacker->DamageTaken, 0);
+
+		const TArray<FHitResult> NextSweep = { MakeHit(A), MakeHit(B) };
+		TestEqual(TEXT("Later sweeps of the swing skip earlier victims"), Resolver.ResolveHits(NextSweep), 0);
+		TestEqual(TEXT("No repeat damage within a swing"), A->DamageTaken, 1);
+
+		Params.MaxHits = 1;
+		Resolver.BeginSwing(Attacker, Params);
+		TestEqual(TEXT("A new swing can hit again"), Resolver.ResolveHits(NextSweep), 1);
+		TestEqual(TEXT("New swing damages the first victim"), A->DamageTaken, 2);
+		TestEqual(TEXT("New swing respects its own capacity"), B->DamageTaken, 1);
+	}
+	GP4TestWorld::Destroy(World);
+	return true;
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FCombatHitResolverClassCacheTest, "GP4.Combat.HitResolver.PerClassCache", EAutomationTestFlags::EditorContext | EAutomationTestFlags::EngineFilter)
+bool FCombatHitResolverClassCacheTest::RunTest(const FString& Parameters)
+{
+	using namespace CombatHitResolverTests;
+
+	UWorld* World = GP4TestWorld::Create(TEXT("CombatHitResolverTestWorld"));
+	{
+		ACombatHitResolverTestTarget* A = World->SpawnActor<ACombatHitResolverTestTarget>();
+		ACombatHitResolverTestTarget* B = World->SpawnActor<ACombatHitResolverTestTarget>();
+		AActor* Plain = World->SpawnActor<AActor>();
+
+		FCombatHitResolver Resolver;
+		TestTrue(TEXT("Damageable class is recognised"), Resolver.IsDamageableClass(A->GetClass()));
+		TestTrue(TEXT("Cached answer stays the same"), Resolver.IsDamageableClass(B->GetClass()));
+		TestFalse(TEXT("Plain actors are not damageable"), Resolver.IsDamageableClass(Plain->GetClass()));
+
+		// the first lookup scans, the second instance of the class goes through the cached component name
+		TestTrue(TEXT("Tagged mesh found by scan"), Resolver.FindDamageableSkelMesh(A) == A->DamageableMesh);
+		TestTrue(TEXT("Cached name resolves on another instance"), Resolver.FindDamageableSkelMesh(B) == B->DamageableMesh);
+		TestNull(TEXT("Classes without a tagged mesh return null"), Resolver.FindDamageableSkelMesh(Plain));
+
+		// an instance whose mesh lost its tag falls back to a scan instead of trusting the cache
+		B->DamageableMesh->ComponentTags.Reset();
+		TestNull(TEXT("Untagged instance is not matched through the cache"), Resolver.FindDamageableSkelMesh(B));
+	}
+	GP4TestWorld::Destroy(World);
+	return true;
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FCombatHitResolverKillTest, "GP4.Combat.HitResolver.FeedbackOnKillingBlow", EAutomationTestFlags::EditorContext | EAutomationTestFlags::EngineFilter)
+bool FCombatHitResolverKillTest::RunTest(const FString& Parameters)
+{
+	using namespace CombatHitResolverTests;
+
+	UWorld* World = GP4TestWorld::Create(TEXT("CombatHitResolverTestWorld"));
+	{
+		ACombatHitResolverTestTarget* Victim = World->SpawnActor<ACombatHitResolverTestTarget>();
+		Victim->bDestroyOnDamage = true;
+
+		FCombatHitResolver Resolver;
+		Resolver.BeginSwing(nullptr, FCombatHitParams());
+
+		int32 Feedback = 0;
+		const TArray<FHitResult> Sweep = { MakeHit(Victim) };
+		Resolver.ResolveHits(Sweep, [&Feedback](AActor*) { ++Feedback; });
+		TestEqual(TEXT("Victim destroyed by the hit still gets feedback"), Feedback, 1);
+	}
+	GP4TestWorld::Destroy(World);
+	return true;
+}
@@ -0,0 +1,70 @@
+﻿// EnemyBroadphaseTests.cpp - Automation tests for the combat enemy grid
+
+#include "Misc/AutomationTest.h"
+#include "Tests/TestWorldHelpers.h"
+#include "Engine/World.h"
+#include "Character/AICharacterBase.h"
+#include "Systems/AISpawningSystem/EnemyBroadphaseSubsystem.h"
+
+namespace EnemyBroadphaseTests
+{
+	AAICharacterBase* SpawnEnemy(UWorld* World, const FVector& Location)
+	{
+		FActorSpawnParameters Params;
+		Params.SpawnCollisionHandlingOverride = ESpawnActorCollisionHandlingMethod::AlwaysSpawn;
+		return World->SpawnActor<AAICharacterBase>(AAICharacterBase::StaticClass(), Location, FRotator::ZeroRotator, Params);
+	}
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FEnemyBroadphaseQueryTest, "GP4.Combat.EnemyBroadphase.TracksMovesAndDeaths", EAutomationTestFlags::EditorContext | EAutomationTestFlags::EngineFilter)
+bool FEnemyBroadphaseQueryTest::RunTest(const FString& Parameters)
+{
+	UWorld* World = GP4TestWorld::Create(TEXT("EnemyBroadphaseTestWorld"));
+	{
+		UEnemyBroadphaseSubsystem* Grid = World->GetSubsystem<UEnemyBroadphaseSubsystem>();
+		TestNotNull(TEXT("Broadphase subsystem exists"), Grid);
+		if (Grid)
+		{
+			TestTrue(TEXT("Inactive grid never rules out a sweep"), Grid->MayOverlapTargets(FVector::ZeroVector, FVector(100, 0, 0), 10.f));
+			Grid->ActivateGrid(500.f);
+
+			AAICharacterBase* Near = EnemyBroadphaseTests::SpawnEnemy(World, FVector(300, 0, 0));
+			AAICharacterBase* Far = EnemyBroadphaseTests::SpawnEnemy(World, FVector(5000, 5000, 0));
+			Grid->AddEnemy(Near);
+			Grid->AddEnemy(Far);
+			TestEqual(TEXT("Both enemies are tracked"), Grid->GetNumEnemies(), 2);
+
+			FEnemyCandidateList Candidates;
+			Grid->QuerySweptSphere(FVector::ZeroVector, FVector(200, 0, 0), 50.f, Candidates);
+			TestEqual(TEXT("Only the nearby enemy is a candidate"), Candidates.Num(), 1);
+			TestTrue(TEXT("Candidate is the nearby enemy"), Candidates.Num() == 1 && Candidates[0] == Near);
+
+			// Move the far one next to the swing and let the brain-side update pick it up
+			Far->SetActorLocation(FVector(0, 150, 0));
+			const TArray<AAICharacterBase*> Active = { Near, Far };
+			Grid->UpdateEnemies(Active);
+			Grid->QuerySweptSphere(FVector::ZeroVector, FVector(200, 0, 0), 50.f, Candidates);
+			TestEqual(TEXT("Moved enemy changes cell"), Candidates.Num(), 2);
+
+			Grid->RemoveEnemy(Near);
+			Grid->RemoveEnemy(Far);
+			TestFalse(TEXT("Empty grid rules out the sweep"), Grid->MayOverlapTargets(FVector::ZeroVector, FVector(200, 0, 0), 50.f));
+
+			// A damageable prop keeps the sweep alive with no enemy around, unless it is the one doing the sweeping
+			AActor* Prop = World->SpawnActor<AActor>(AActor::StaticClass(), FVector(100, 0, 0), FRotator::ZeroRotator);
+			Grid->AddDamageable(Prop);
+			TestEqual(TEXT("Prop is tracked apart from enemies"), Grid->GetNumDamageables(), 1);
+			TestEqual(TEXT("Prop is not counted as an enemy"), Grid->GetNumEnemies(), 0);
+			TestTrue(TEXT("Nearby damageable keeps the sweep"), Grid->MayOverlapTargets(FVector::ZeroVector, FVector(200, 0, 0), 50.f));
+			TestFalse(TEXT("Ignored actor does not keep the sweep"), Grid->MayOverlapTargets(FVector::ZeroVector, FVector(200, 0, 0), 50.f, Prop));
+			Grid->QuerySweptSphere(FVector::ZeroVector, FVector(200, 0, 0), 50.f, Candidates);
+			TestEqual(TEXT("Enemy query skips damageables"), Candidates.Num(), 0);
+
+			Prop->Destroy();
+			Grid->UpdateDamageables();
+			TestEqual(TEXT("Destroyed prop is dropped"), Grid->GetNumDamageables(), 0);
+		}
+	}
+	GP4TestWorld::Destroy(World);
+	return true;
+}
@@ -0,0 +1,270 @@
+﻿// LookTraceTests.cpp - Automation tests and benchmarks for trace queries
+
+#include "Misc/AutomationTest.h"
+#include "Tests/TestWorldHelpers.h"
+#include "Engine/World.h"
+#include "Components/CapsuleComponent.h"
+#include "Components/SphereComponent.h"
+#include "Engine/CollisionProfile.h"
+#include "GameFramework/Pawn.h"
+#include "Core/Subsystems/LookTraceProfiler.h"
+#include "Core/Subsystems/LookTraceSubsystem.h"
+
+namespace LookTraceTests
+{
+	// Row of capsules across the swing path, blocking everything like an enemy would block the melee channel
+	void SpawnTargets(UWorld* World, int32 Count)
+	{
+		for (int32 i = 0; i < Count; ++i)
+		{
+			AActor* Target = World->SpawnActor<AActor>();
+			UCapsuleComponent* Capsule = NewObject<UCapsuleComponent>(Target);
+			Capsule->InitCapsuleSize(20.f, 90.f);
+			Capsule->SetCollisionProfileName(UCollisionProfile::BlockAll_ProfileName);
+			Target->SetRootComponent(Capsule);
+			Capsule->RegisterComponent();
+			Target->SetActorLocation(FVector(150.f, (i - Count / 2) * 60.f, 0.f));
+		}
+	}
+
+	// Small overlapping sphere, so multi-sweeps report every target along the path instead of stopping at the first
+	USphereComponent* SpawnSphereTarget(UWorld* World, const FVector& Location, float Radius)
+	{
+		AActor* Target = World->SpawnActor<AActor>();
+		USphereComponent* Sphere = NewObject<USphereComponent>(Target);
+		Sphere->InitSphereRadius(Radius);
+		Sphere->SetCollisionProfileName(TEXT("OverlapAll"));
+		Target->SetRootComponent(Sphere);
+		Sphere->RegisterComponent();
+		Target->SetActorLocation(Location);
+		return Sphere;
+	}
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FLookTracePresetIgnoreListTest, "GP4.LookTrace.Presets.IgnoreRegisteredPawn", EAutomationTestFlags::EditorContext | EAutomationTestFlags::EngineFilter)
+bool FLookTracePresetIgnoreListTest::RunTest(const FString& Parameters)
+{
+	UWorld* World = GP4TestWorld::Create(TEXT("LookTraceTestWorld"));
+	{
+		// Blocking pawn the traces start inside of
+		APawn* Pawn = World->SpawnActor<APawn>();
+		UCapsuleComponent* Capsule = NewObject<UCapsuleComponent>(Pawn);
+		Capsule->InitCapsuleSize(40.f, 90.f);
+		Capsule->SetCollisionProfileName(UCollisionProfile::BlockAll_ProfileName);
+		Pawn->SetRootComponent(Capsule);
+		Capsule->RegisterComponent();
+
+		ULookTraceSubsystem* Subsystem = NewObject<ULookTraceSubsystem>(World);
+		Subsystem->RegisterQueryPresets(Pawn);
+
+		const FHitResult DefaultHit = Subsystem->GetHitResultFromPawnForwardSphereTrace(Pawn, 500.f, 10.f, ECC_Camera, ELookTracePreset::Default);
+		const FHitResult VaultHit = Subsystem->GetHitResultFromPawnForwardSphereTrace(Pawn, 500.f, 10.f, ECC_Camera, ELookTracePreset::VaultProbe);
+		TestTrue(TEXT("Default preset has no ignore list"), DefaultHit.GetActor() == Pawn);
+		TestNull(TEXT("Pawn presets ignore the registered pawn"), VaultHit.GetActor());
+
+		int32 Queries = 0;
+		float Milliseconds = 0.f;
+		Subsystem->GetPresetQueryStats(ELookTracePreset::VaultProbe, Queries, Milliseconds);
+		TestEqual(TEXT("Queries are counted per preset"), Queries, 1);
+		Subsystem->GetPresetQueryStats(ELookTracePreset::Melee, Queries, Milliseconds);
+		TestEqual(TEXT("Unused presets stay at zero"), Queries, 0);
+	}
+	GP4TestWorld::Destroy(World);
+	return true;
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FLookTraceProfilerAggregateTest, "GP4.LookTrace.Profiler.AggregatesPerCaller", EAutomationTestFlags::EditorContext | EAutomationTestFlags::EngineFilter)
+bool FLookTraceProfilerAggregateTest::RunTest(const FString& Parameters)
+{
+	FLookTraceProfiler Profiler;
+
+	FLookTraceRecord Record;
+	Record.Caller = TEXT("DashState.DashHit");
+	Record.Microseconds = 10.0;
+	Profiler.Record(Record);
+	TestEqual(TEXT("Nothing is recorded outside a capture"), Profiler.GetNumRecords(), 0);
+
+	Profiler.StartCapture();
+	const uint64 Frame = GFrameCounter;
+
+	// Two cheap traces in one frame, then one more the next frame
+	Record.Frame = Frame;
+	Profiler.Record(Record);
+	Profiler.Record(Record);
+	Record.Frame = Frame + 1;
+	Profiler.Record(Record);
+
+	FLookTraceRecord Melee;
+	Melee.Caller = TEXT("MeleeState.Swing");
+	Melee.Frame = Frame;
+	Melee.Hits = 3;
+	Melee.Microseconds = 50.0;
+	Profiler.Record(Melee);
+	Profiler.StopCapture();
+
+	TArray<FLookTraceCallerStats> Top;
+	Profiler.GetTopCallers(1, Top);
+	TestEqual(TEXT("Top-N is truncated"), Top.Num(), 1);
+	TestEqual(TEXT("Most expensive caller first"), Top.Num() == 1 ? Top[0].Caller : NAME_None, FName(TEXT("MeleeState.Swing")));
+
+	Profiler.GetTopCallers(INDEX_NONE, Top);
+	TestEqual(TEXT("Both callers aggregated"), Top.Num(), 2);
+	if (Top.Num() == 2)
+	{
+		const FLookTraceCallerStats& Dash = Top[1];
+		TestEqual(TEXT("Traces counted per caller"), Dash.Traces, 3);
+		TestEqual(TEXT("Frames with traces counted"), Dash.FramesActive, 2);
+		TestEqual(TEXT("Peak frame sums the traces of one frame"), Dash.PeakFrameMicroseconds, 20.0);
+		TestEqual(TEXT("Hits summed"), Top[0].Hits, 3);
+	}
+	TestEqual(TEXT("Raw records kept for export"), Profiler.GetNumRecords(), 4);
+	TestTrue(TEXT("Callers CSV lists the callers"), Profiler.BuildCallersCsv().Contains(TEXT("MeleeState.Swing")));
+	return true;
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FLookTraceBladeSweepTest, "GP4.LookTrace.BladeSweep.Geometry", EAutomationTestFlags::EditorContext | EAutomationTestFlags::EngineFilter)
+bool FLookTraceBladeSweepTest::RunTest(const FString& Parameters)
+{
+	using namespace LookTraceTests;
+
+	UWorld* World = GP4TestWorld::Create(TEXT("LookTraceTestWorld"));
+	{
+		ULookTraceSubsystem* Subsystem = NewObject<ULookTraceSubsystem>(World);
+		TArray<FHitResult> Hits;
+		auto CountHitsOn = [&Hits](const UPrimitiveComponent* Comp)
+		{
+			return Hits.FilterByPredicate([Comp](const FHitResult& Hit) { return Hit.GetComponent() == Comp; }).Num();
+		};
+
+		// Quarter swing of a 1000 unit blade around its base: the tip covers ~1414 units, far past the substep cap.
+		// Tips are interpolated linearly, so the tip path is the straight line between the two tips
+		const FVector Base(0.f, 0.f, 0.f);
+		const FVector PrevTip(1000.f, 0.f, 0.f);
+		const FVector CurrentTip(0.f, 1000.f, 0.f);
+		auto TipAt = [&](float T) { return FMath::Lerp(PrevTip, CurrentTip, T); };
+
+		// Middle of the fourth of eight substeps: inside a substep capsule and on the tip path
+		USphereComponent* SubstepTarget = SpawnSphereTarget(World, TipAt(0.4375f), 5.f);
+		// Boundary between substeps: the substep capsules pass ~45 units short of it
+		USphereComponent* GapTarget = SpawnSphereTarget(World, TipAt(0.5f), 5.f);
+
+		Subsystem->SweepBlade(ELookTracePreset::Default, Base, PrevTip, Base, CurrentTip, 5.f, ECC_Camera, Hits);
+		TestEqual(TEXT("Target between capped substeps is caught by the tip sweep"), CountHitsOn(GapTarget), 1);
+		TestEqual(TEXT("Target hit by a substep and the tip sweep is reported once"), CountHitsOn(SubstepTarget), 1);
+
+		// Short move of a 200 unit blade, well under the cap: the capsule ends reach Radius past the tip
+		USphereComponent* PastTipTarget = SpawnSphereTarget(World, FVector(203.f, 0.f, 300.f), 1.f);
+		USphereComponent* OutOfReachTarget = SpawnSphereTarget(World, FVector(210.f, 0.f, 300.f), 1.f);
+		Subsystem->SweepBlade(ELookTracePreset::Default, FVector(0.f, -1.f, 300.f), FVector(200.f, -1.f, 300.f),
+			FVector(0.f, 1.f, 300.f), FVector(200.f, 1.f, 300.f), 5.f, ECC_Camera, Hits);
+		TestEqual(TEXT("Blade reaches Radius past its tip"), CountHitsOn(PastTipTarget), 1);
+		TestEqual(TEXT("Blade does not reach further than Radius past its tip"), CountHitsOn(OutOfReachTarget), 0);
+
+		// The bat's owner is ignored even when it is not a pawn
+		FVector PrevBase(0.f, -1.f, 300.f), PrevBladeTip(200.f, -1.f, 300.f), CurrentBase(0.f, 1.f, 300.f), CurrentBladeTip(200.f, 1.f, 300.f);
+		Subsystem->GetHitResultFromCapsuleSweep(PastTipTarget, CurrentBase, CurrentBladeTip, PrevBase, PrevBladeTip, 5.f, Hits, ECC_Camera, ELookTracePreset::Melee);
+		TestEqual(TEXT("Bat owner is not hit by its own swing"), CountHitsOn(PastTipTarget), 0);
+	}
+	GP4TestWorld::Destroy(World);
+	return true;
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FLookTraceAsyncPollTest, "GP4.LookTrace.Async.PollKeepsOneRequestInFlight", EAutomationTestFlags::EditorContext | EAutomationTestFlags::EngineFilter)
+bool FLookTraceAsyncPollTest::RunTest(const FString& Parameters)
+{
+	UWorld* World = GP4TestWorld::Create(TEXT("LookTraceTestWorld"));
+	{
+		ULookTraceSubsystem* Subsystem = NewObject<ULookTraceSubsystem>(World);
+
+		int32 Requests = 0;
+		auto Request = [Subsystem, &Requests]()
+		{
+			++Requests;
+			return Subsystem->RequestSphereSweepAsync(FVector::ZeroVector, FVector(1000.f, 0.f, 0.f), 1.f, ECC_Visibility, ELookTracePreset::PlayerAim);
+		};
+
+		FLookTraceHandle Handle;
+		FHitResult Hit;
+		TestFalse(TEXT("First poll has no result yet"), Subsystem->PollAsyncTrace(Handle, Hit, Request));
+		TestEqual(TEXT("First poll issues a request"), Requests, 1);
+		const int32 FirstId = Handle.Id;
+
+		// Async batches only run with the world tick, so the request stays pending across these polls like it would
+		// when the caller ticks again before the result lands
+		for (int32 Poll = 0; Poll < 5; ++Poll)
+		{
+			TestFalse(TEXT("Pending poll has no result"), Subsystem->PollAsyncTrace(Handle, Hit, Request));
+		}
+		TestEqual(TEXT("Pending handle is not replaced"), Requests, 1);
+		TestEqual(TEXT("Pending handle keeps its id"), Handle.Id, FirstId);
+		TestEqual(TEXT("Only one request is in flight"), Subsystem->GetNumPendingAsyncTraces(), 1);
+
+		Subsystem->CancelAsyncTrace(Handle);
+		Subsystem->PollAsyncTrace(Handle, Hit, Request);
+		TestEqual(TEXT("Cancelled handle is re-requested"), Requests, 2);
+		TestEqual(TEXT("Cancelled request left nothing behind"), Subsystem->GetNumPendingAsyncTraces(), 1);
+		Subsystem->CancelAsyncTrace(Handle);
+	}
+	GP4TestWorld::Destroy(World);
+	return true;
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FLookTraceMeleeBufferBenchmark, "GP4.LookTrace.Benchmark.MeleeTraceBufferAllocations", EAutomationTestFlags::EditorContext | EAutomationTestFlags::PerfFilter)
+bool FLookTraceMeleeBufferBenchmark::RunTest(const FString& Parameters)
+{
+	constexpr int32 Frames = 1000;
+	constexpr int32 TargetCount = 4;
+	constexpr float Reach = 300.f;
+	constexpr float Radius = 40.f;
+
+	UWorld* World = GP4TestWorld::Create(TEXT("LookTraceTestWorld"));
+	{
+		LookTraceTests::SpawnTargets(World, TargetCount);
+		ULookTraceSubsystem* Subsystem = NewObject<ULookTraceSubsystem>(World);
+
+		// Simulated swing: start point slides across the row, like UMeleeState::Tick
+		auto SwingStart = [](int32 Frame)
+		{
+			const float Alpha = (Frame % 30) / 29.f;
+			return FVector(0.f, FMath::Lerp(-150.f, 150.f, Alpha), 0.f);
+		};
+
+		// Warm-up frame sizes the caller buffer once
+		FTraceHitBuffer MeleeHits;
+		Subsystem->SphereTraceFromLocationWithDirection(FVector::ForwardVector, SwingStart(0), Reach, Radius, ECC_Camera, ELookTracePreset::Melee, MeleeHits);
+		TestTrue(TEXT("Swing trace hits the targets"), MeleeHits.Num() > 0);
+
+		const FHitResult* BufferData = MeleeHits.GetData();
+		const SIZE_T BufferBytes = MeleeHits.GetAllocatedSize();
+		int32 FramesWithBufferGrowth = 0;
+		int32 TotalHits = 0;
+
+		const double BufferStart = FPlatformTime::Seconds();
+		for (int32 Frame = 0; Frame < Frames; ++Frame)
+		{
+			Subsystem->SphereTraceFromLocationWithDirection(FVector::ForwardVector, SwingStart(Frame), Reach, Radius, ECC_Camera, ELookTracePreset::Melee, MeleeHits);
+			for (const FHitResult& Hit : MeleeHits) TotalHits += Hit.bBlockingHit ? 1 : 0;
+
+			if (MeleeHits.GetData() != BufferData || MeleeHits.GetAllocatedSize() != BufferBytes)
+			{
+				++FramesWithBufferGrowth;
+			}
+		}
+		const double BufferMs = (FPlatformTime::Seconds() - BufferStart) * 1000.0 / Frames;
+
+		const double ValueStart = FPlatformTime::Seconds();
+		for (int32 Frame = 0; Frame < Frames; ++Frame)
+		{
+			TArray<FHitResult> Hits = Subsystem->GetHitResultFromLocationWithDirectionSphereTrace(FVector::ForwardVector, SwingStart(Frame), Reach, Radius, ECC_Camera, ELookTracePreset::Melee);
+			for (auto Hit : Hits) TotalHits += Hit.bBlockingHit ? 1 : 0;
+		}
+		const double ValueMs = (FPlatformTime::Seconds() - ValueStart) * 1000.0 / Frames;
+
+		AddInfo(FString::Printf(TEXT("Caller buffer: %.4f ms per melee frame"), BufferMs));
+		AddInfo(FString::Printf(TEXT("By value:      %.4f ms per melee frame (%d hits total)"), ValueMs, TotalHits));
+
+		TestEqual(TEXT("Melee frames that heap-allocated hit storage"), FramesWithBufferGrowth, 0);
+	}
+	GP4TestWorld::Destroy(World);
+	return true;
+}
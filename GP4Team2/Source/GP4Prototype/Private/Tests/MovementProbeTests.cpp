@@ -0,0 +1,71 @@
+﻿// MovementProbeTests.cpp - Automation tests for the adaptive vault probe scheduler
+
+#include "Misc/AutomationTest.h"
+#include "Systems/MovementSystem/MovementProbeScheduler.h"
+
+namespace MovementProbeTests
+{
+	// What a forward sweep of Length from X would report against a wall at WallX
+	FHitResult TraceWall(float X, float Length, float WallX)
+	{
+		FHitResult Hit;
+		if (WallX - X <= Length)
+		{
+			Hit.bBlockingHit = true;
+			Hit.Distance = FMath::Max(WallX - X, 0.f);
+		}
+		return Hit;
+	}
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FMovementProbeScheduleTest, "GP4.Movement.Probes.SprintTowardWall", EAutomationTestFlags::EditorContext | EAutomationTestFlags::EngineFilter)
+bool FMovementProbeScheduleTest::RunTest(const FString& Parameters)
+{
+	constexpr float TraceLength = 500.f;
+	constexpr float WallX = 3000.f;
+	constexpr float Speed = 1200.f;
+	constexpr double DeltaTime = 1.0 / 60.0;
+
+	FMovementProbeScheduler Scheduler;
+	const EMovementProbe Probe = EMovementProbe::SprintVault;
+
+	int32 ReferenceFrame = INDEX_NONE;
+	int32 ScheduledFrame = INDEX_NONE;
+	int32 Frames = 0;
+
+	for (int32 Frame = 0; Frame < 600 && (ReferenceFrame == INDEX_NONE || ScheduledFrame == INDEX_NONE); ++Frame)
+	{
+		const double Now = Frame * DeltaTime;
+		const FVector Location(Speed * Now, 0.f, 0.f);
+		Frames++;
+
+		// per-tick probe
+		if (ReferenceFrame == INDEX_NONE && MovementProbeTests::TraceWall(Location.X, TraceLength, WallX).bBlockingHit) ReferenceFrame = Frame;
+
+		// scheduled probe
+		if (Scheduler.ShouldProbe(Probe, Now, Location, FVector::ForwardVector))
+		{
+			const float Length = Scheduler.GetLookaheadLength(TraceLength, Speed);
+			Scheduler.RecordProbe(Probe, Now, Location, FVector::ForwardVector, Speed, TraceLength, MovementProbeTests::TraceWall(Location.X, Length, WallX));
+		}
+
+		FHitResult Hit;
+		if (ScheduledFrame == INDEX_NONE && Scheduler.GetHitInRange(Probe, Location, TraceLength, Hit))
+		{
+			ScheduledFrame = Frame;
+			TestTrue(TEXT("Reported distance is measured from the current location"), FMath::IsNearlyEqual(Hit.Distance, WallX - Location.X, 1.f));
+		}
+	}
+
+	TestTrue(TEXT("Per-tick probe reaches the wall"), ReferenceFrame != INDEX_NONE);
+	TestEqual(TEXT("Scheduled probe spots the wall on the same frame"), ScheduledFrame, ReferenceFrame);
+	TestTrue(TEXT("Scheduled probe traces at most half as often"), Scheduler.GetNumProbes(Probe) * 2 <= Frames);
+	AddInfo(FString::Printf(TEXT("%d frames, %d probes, %d reuses"), Frames, Scheduler.GetNumProbes(Probe), Scheduler.GetNumReuses(Probe)));
+
+	// turning invalidates the last result
+	const double Now = Frames * DeltaTime;
+	const FVector Location(Speed * Now, 0.f, 0.f);
+	TestTrue(TEXT("Turning forces a fresh probe"), Scheduler.ShouldProbe(Probe, Now, Location, FVector::RightVector));
+
+	return true;
+}
@@ -0,0 +1,276 @@
+﻿// ObjectPoolTests.cpp - Automation tests and benchmarks for the object pool
+
+#include "Misc/AutomationTest.h"
+#include "Tests/TestWorldHelpers.h"
+#include "Engine/World.h"
+#include "GameFramework/Actor.h"
+#include "ObjectPool/ObjectPoolBase.h"
+#include "ObjectPool/ObjectPoolSubsystem.h"
+#include "ObjectPool/ObjectPoolTemplate.h"
+#include "ObjectPool/PooledActorComponent.h"
+#include "Systems/CombatSystem/Bullets/Bullet.h"
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FObjectPoolAcquireReleaseTest, "GP4.ObjectPool.AcquireRelease.FreeListBookkeeping", EAutomationTestFlags::EditorContext | EAutomationTestFlags::EngineFilter)
+bool FObjectPoolAcquireReleaseTest::RunTest(const FString& Parameters)
+{
+	UWorld* World = GP4TestWorld::Create(TEXT("ObjectPoolTestWorld"));
+	{
+		TObjectPool<AActor> Pool(World, AActor::StaticClass(), 4, nullptr);
+		TestEqual(TEXT("All prewarmed actors start free"), Pool.NumFree(), 4);
+
+		AActor* A = Pool.Acquire();
+		AActor* B = Pool.Acquire();
+		TestTrue(TEXT("Acquire hands out distinct actors"), A && B && A != B);
+		// A plain AActor never ticks, so activation is checked through visibility and collision
+		TestTrue(TEXT("Acquired actor is visible and collides"), A && !A->IsHidden() && A->GetActorEnableCollision());
+		TestEqual(TEXT("Two active after two acquires"), Pool.NumActive(), 2);
+
+		TestTrue(TEXT("Release of own actor succeeds"), Pool.Release(A));
+		TestFalse(TEXT("Double release reports the actor as already free"), Pool.Release(A));
+		TestEqual(TEXT("Double release does not duplicate the free slot"), Pool.NumFree(), 3);
+		TestTrue(TEXT("Released actor is dormant"), A->IsHidden() && !A->GetActorEnableCollision());
+
+		AActor* Foreign = World->SpawnActor<AActor>();
+		TestFalse(TEXT("Release of a foreign actor is rejected"), Pool.Release(Foreign));
+
+		Pool.Acquire(); Pool.Acquire(); Pool.Acquire();
+		TestNull(TEXT("Dry pool returns null instead of spawning"), Pool.Acquire());
+		TestEqual(TEXT("Grow adds straight to the free stack"), Pool.Grow(2), 2);
+		TestNotNull(TEXT("Acquire succeeds after grow"), Pool.Acquire());
+	}
+	GP4TestWorld::Destroy(World);
+	return true;
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FObjectPoolGenericObjectTest, "GP4.ObjectPool.AcquireRelease.FactoryAndResetFunctor", EAutomationTestFlags::EditorContext | EAutomationTestFlags::EngineFilter)
+bool FObjectPoolGenericObjectTest::RunTest(const FString& Parameters)
+{
+	int32 Created = 0;
+	int32 Activations = 0;
+	int32 Deactivations = 0;
+
+	TObjectPool<UObject> Pool(
+		[&Created]() { ++Created; return NewObject<UObject>(GetTransientPackage()); },
+		[&Activations, &Deactivations](UObject*, bool bActive) { bActive ? ++Activations : ++Deactivations; },
+		3);
+
+	TestEqual(TEXT("Factory fills the initial size"), Created, 3);
+	TestEqual(TEXT("New objects are reset to inactive"), Deactivations, 3);
+
+	UObject* A = Pool.Acquire();
+	TestNotNull(TEXT("Acquire returns a factory object"), A);
+	TestEqual(TEXT("Acquire runs the reset functor"), Activations, 1);
+	TestTrue(TEXT("Release of own object succeeds"), Pool.Release(A));
+	TestEqual(TEXT("Release runs the reset functor"), Deactivations, 4);
+	TestEqual(TEXT("Reacquire reuses instead of creating"), Pool.Acquire(), A);
+	TestEqual(TEXT("No extra objects created"), Created, 3);
+
+	TestEqual(TEXT("Trim drops free non-actor objects"), Pool.TrimFree(8), 2);
+	TestEqual(TEXT("Active object survives trim"), Pool.Num(), 1);
+	return true;
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FObjectPoolBackReferenceTest, "GP4.ObjectPool.Release.BackReferenceComponent", EAutomationTestFlags::EditorContext | EAutomationTestFlags::EngineFilter)
+bool FObjectPoolBackReferenceTest::RunTest(const FString& Parameters)
+{
+	UWorld* World = GP4TestWorld::Create(TEXT("ObjectPoolTestWorld"));
+	{
+		UObjectPoolBase* Pool = NewObject<UObjectPoolBase>(World);
+		Pool->InitializePool(AActor::StaticClass(), 2);
+
+		AActor* Actor = Pool->AcquireActor();
+		UPooledActorComponent* PooledComp = Actor ? Actor->FindComponentByClass<UPooledActorComponent>() : nullptr;
+		TestNotNull(TEXT("Pooled actors carry a back-reference component"), PooledComp);
+		if (PooledComp)
+		{
+			TestEqual(TEXT("Back-reference points at the owning pool"), PooledComp->GetOwningPool(), Pool);
+			TestTrue(TEXT("Release through the back-reference succeeds"), PooledComp->ReleaseToPool());
+			TestEqual(TEXT("Actor is back on the free stack"), Pool->GetNumActive(), 0);
+			TestFalse(TEXT("Second release through the back-reference is rejected"), PooledComp->ReleaseToPool());
+			TestEqual(TEXT("Double release is counted once"), Pool->GetTelemetry().Releases, 1);
+		}
+
+		AActor* Foreign = World->SpawnActor<AActor>();
+		TestFalse(TEXT("Non-pooled actor is rejected"), Pool->ReleaseActor(Foreign));
+
+		// Native poolables get the back-reference handed to them at spawn
+		UObjectPoolBase* BulletPool = NewObject<UObjectPoolBase>(World);
+		BulletPool->InitializePool(ABullet::StaticClass(), 1);
+		ABullet* Bullet = Cast<ABullet>(BulletPool->AcquireActor());
+		TestTrue(TEXT("Bullet caches the component the pool added"),
+			Bullet && Bullet->GetPooledComponent() && Bullet->GetPooledComponent() == Bullet->FindComponentByClass<UPooledActorComponent>());
+		TestTrue(TEXT("Release through the cached back-reference succeeds"), Bullet && Bullet->GetPooledComponent()->ReleaseToPool());
+	}
+	GP4TestWorld::Destroy(World);
+	return true;
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FObjectPoolTimeSlicedWarmUpTest, "GP4.ObjectPool.WarmUp.TimeSlicedAndPredictive", EAutomationTestFlags::EditorContext | EAutomationTestFlags::EngineFilter)
+bool FObjectPoolTimeSlicedWarmUpTest::RunTest(const FString& Parameters)
+{
+	UWorld* World = GP4TestWorld::Create(TEXT("ObjectPoolTestWorld"));
+	{
+		FPoolGrowthPolicy Policy;
+		Policy.bTimeSliced = true;
+		Policy.LowFreeFraction = 0.5f;
+		Policy.MinGrowthStep = 4;
+
+		UObjectPoolBase* Pool = NewObject<UObjectPoolBase>(World);
+		Pool->InitializePoolWithPolicy(AActor::StaticClass(), 8, Policy);
+		TestEqual(TEXT("Time-sliced pool spawns nothing up front"), Pool->GetNumFree(), 0);
+		TestTrue(TEXT("Warm-up is queued"), Pool->HasPendingWarmUp());
+
+		// An already expired deadline still makes progress one actor at a time
+		Pool->TickWarmUp(0.0);
+		TestEqual(TEXT("Expired budget spawns exactly one"), Pool->GetNumFree(), 1);
+
+		while (Pool->TickWarmUp(FPlatformTime::Seconds() + 1.0)) {}
+		TestEqual(TEXT("Warm-up completes"), Pool->GetNumFree(), 8);
+
+		for (int32 i = 0; i < 5; ++i)
+		{
+			Pool->AcquireActor();
+		}
+		TestTrue(TEXT("Dropping below the free threshold queues background growth"), Pool->HasPendingWarmUp());
+		TestEqual(TEXT("Peak occupancy is tracked"), Pool->GetPeakActive(), 5);
+	}
+	GP4TestWorld::Destroy(World);
+	return true;
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FObjectPoolTelemetryTest, "GP4.ObjectPool.Telemetry.CountersAndCsv", EAutomationTestFlags::EditorContext | EAutomationTestFlags::EngineFilter)
+bool FObjectPoolTelemetryTest::RunTest(const FString& Parameters)
+{
+	UWorld* World = GP4TestWorld::Create(TEXT("ObjectPoolTestWorld"));
+	{
+		UObjectPoolSubsystem* Subsystem = NewObject<UObjectPoolSubsystem>(World);
+		const FPoolHandle Handle = Subsystem->RegisterPool(AActor::StaticClass(), 2);
+
+		AActor* A = Subsystem->AcquireActorByHandle(Handle);
+		Subsystem->AcquireActorByHandle(Handle);
+		Subsystem->AcquireActorByHandle(Handle); // dry: grows synchronously
+		Subsystem->ReleaseActor(A);
+		Subsystem->ReleaseActor(A);
+		Subsystem->RecordFallbackSpawn(Handle);
+
+		const FPoolTelemetry T = Subsystem->GetPoolTelemetry(Handle);
+		TestEqual(TEXT("Acquires are counted"), T.Acquires, 3);
+		TestEqual(TEXT("Dry acquire is a miss"), T.Misses, 1);
+		TestEqual(TEXT("Other acquires are hits"), T.Hits, 2);
+		TestEqual(TEXT("Double release is counted once"), T.Releases, 1);
+		TestEqual(TEXT("Miss grew the pool once"), T.GrowthEvents, 1);
+		TestEqual(TEXT("Fallback spawns are counted"), T.FallbackSpawns, 1);
+		TestEqual(TEXT("Peak occupancy survives the release"), T.PeakActive, 3);
+		TestEqual(TEXT("Pool reports the telemetry peak"), Subsystem->GetPool(Handle)->GetPeakActive(), 3);
+
+		int32 Bucketed = 0;
+		for (const int32 Count : T.AcquireLatencyBuckets) Bucketed += Count;
+		TestEqual(TEXT("Every acquire lands in one latency bucket"), Bucketed, 3);
+
+		TArray<FString> Lines;
+		Subsystem->BuildTelemetryCsv().ParseIntoArrayLines(Lines);
+		TestEqual(TEXT("CSV has a header and one row per pool"), Lines.Num(), 2);
+		if (Lines.Num() == 2)
+		{
+			TestTrue(TEXT("First latency bucket is below 1us"), Lines[0].Contains(TEXT(",Lat_lt1us,")));
+			TestTrue(TEXT("Last latency bucket is open ended"), Lines[0].EndsWith(TEXT(",Lat_ge1024us")));
+
+			TArray<FString> Header, Row;
+			Lines[0].ParseIntoArray(Header, TEXT(","), false);
+			Lines[1].ParseIntoArray(Row, TEXT(","), false);
+			TestEqual(TEXT("Row has a value per column"), Row.Num(), Header.Num());
+			TestTrue(TEXT("Row starts with handle and class"), Lines[1].StartsWith(TEXT("0,Actor,")));
+			const int32 PeakColumn = Header.IndexOfByKey(TEXT("PeakActive"));
+			TestTrue(TEXT("Row carries the peak"), Row.IsValidIndex(PeakColumn) && Row[PeakColumn] == TEXT("3"));
+		}
+	}
+	GP4TestWorld::Destroy(World);
+	return true;
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FObjectPoolTrimNeverDestroysActiveTest, "GP4.ObjectPool.Trim.NeverDestroysActive", EAutomationTestFlags::EditorContext | EAutomationTestFlags::EngineFilter)
+bool FObjectPoolTrimNeverDestroysActiveTest::RunTest(const FString& Parameters)
+{
+	UWorld* World = GP4TestWorld::Create(TEXT("ObjectPoolTestWorld"));
+	{
+		UObjectPoolBase* Pool = NewObject<UObjectPoolBase>(World);
+		Pool->InitializePool(AActor::StaticClass(), 4);
+
+		// Force growth well past the registered size, then hand most of it back
+		TArray<AActor*> Held;
+		for (int32 i = 0; i < 20; ++i)
+		{
+			Held.Add(Pool->AcquireActor());
+		}
+		for (int32 i = 6; i < Held.Num(); ++i)
+		{
+			Pool->ReleaseActor(Held[i]);
+		}
+		Held.SetNum(6);
+
+		FPoolTrimPolicy Policy;
+		Policy.bEnabled = true;
+		Policy.TrimIntervalSeconds = 0.f;
+		Policy.DecayFraction = 1.f;
+		Policy.bKeepInitialSize = false;
+		Pool->SetTrimPolicy(Policy);
+
+		// First interval only trims down to the free low point seen while acquiring, the second one has no acquires
+		Pool->TickTrim(1.f);
+		Pool->TickTrim(1.f);
+		TestEqual(TEXT("Idle decay removes every idle free actor"), Pool->GetNumFree(), 0);
+		TestEqual(TEXT("Idle decay leaves active actors alone"), Pool->GetNumActive(), 6);
+
+		// A budget smaller than one actor must still not touch active ones
+		Policy.MemoryBudgetKB = 1;
+		Pool->SetTrimPolicy(Policy);
+		Pool->ReleaseActor(Held.Pop());
+		Pool->TickTrim(1.f);
+		Pool->TrimForFloorTransition();
+
+		TestEqual(TEXT("Budget and floor trims leave active actors alone"), Pool->GetNumActive(), 5);
+		for (AActor* Actor : Held)
+		{
+			TestTrue(TEXT("Active actor survived trimming"), IsValid(Actor));
+		}
+	}
+	GP4TestWorld::Destroy(World);
+	return true;
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FObjectPoolAcquireScalingBenchmark, "GP4.ObjectPool.Benchmark.AcquireCostIsFlat", EAutomationTestFlags::EditorContext | EAutomationTestFlags::PerfFilter)
+bool FObjectPoolAcquireScalingBenchmark::RunTest(const FString& Parameters)
+{
+	constexpr int32 Iterations = 10000;
+	const int32 PoolSizes[] = { 10, 100, 1000, 10000 };
+
+	UWorld* World = GP4TestWorld::Create(TEXT("ObjectPoolTestWorld"));
+	TArray<double> NanosPerCycle;
+	for (const int32 PoolSize : PoolSizes)
+	{
+		TObjectPool<AActor> Pool(World, AActor::StaticClass(), PoolSize, nullptr);
+
+		// Keep half the pool in flight so acquire always runs against a partially used pool
+		TArray<AActor*> InFlight;
+		for (int32 i = 0; i < PoolSize / 2; ++i)
+		{
+			InFlight.Add(Pool.Acquire());
+		}
+
+		const double Start = FPlatformTime::Seconds();
+		for (int32 i = 0; i < Iterations; ++i)
+		{
+			AActor* Actor = Pool.Acquire();
+			Pool.Release(Actor);
+		}
+		const double Elapsed = FPlatformTime::Seconds() - Start;
+
+		NanosPerCycle.Add(Elapsed * 1e9 / Iterations);
+		AddInfo(FString::Printf(TEXT("Pool size %5d: %.1f ns per acquire/release"), PoolSize, NanosPerCycle.Last()));
+	}
+	GP4TestWorld::Destroy(World);
+
+	// O(1) means the largest pool stays within noise of the smallest; a linear scan would be ~1000x
+	TestTrue(TEXT("Acquire cost does not scale with pool size"), NanosPerCycle.Last() < NanosPerCycle[0] * 4.0);
+	return true;
+}
@@ -0,0 +1,15 @@
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Systems/CombatSystem/Bullets/Bullet.h"
+#include "ProjectileTestBullet.generated.h"
+
+// Bullet class with an engine sphere as its mesh, so the simulated projectile path has something to instance
+UCLASS(NotBlueprintable, NotPlaceable, HideDropdown)
+class AProjectileTestBullet : public ABullet
+{
+	GENERATED_BODY()
+
+public:
+	AProjectileTestBullet();
+};
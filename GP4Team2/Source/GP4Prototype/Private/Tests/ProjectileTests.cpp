@@ -0,0 +1,255 @@
+﻿// ProjectileTests.cpp - Automation tests and benchmarks for bullet movement
+
+#include "Misc/AutomationTest.h"
+#include "Tests/TestWorldHelpers.h"
+#include "Engine/World.h"
+#include "HAL/IConsoleManager.h"
+#include "Components/CapsuleComponent.h"
+#include "Engine/CollisionProfile.h"
+#include "Engine/StaticMesh.h"
+#include "EngineUtils.h"
+#include "Components/BoxComponent.h"
+#include "Components/InstancedStaticMeshComponent.h"
+#include "UObject/ConstructorHelpers.h"
+#include "Systems/CombatSystem/Bullets/Bullet.h"
+#include "Systems/CombatSystem/Bullets/ProjectileSimulationSubsystem.h"
+#include "Systems/CombatSystem/Bullets/ProjectileUpdateSubsystem.h"
+#include "Tests/CombatHitResolverTestTarget.h"
+#include "Tests/ProjectileTestBullet.h"
+
+AProjectileTestBullet::AProjectileTestBullet()
+{
+	static ConstructorHelpers::FObjectFinder<UStaticMesh> SphereMesh(TEXT("/Engine/BasicShapes/Sphere.Sphere"));
+	if (SphereMesh.Succeeded()) GetBulletMesh()->SetStaticMesh(SphereMesh.Object);
+}
+
+namespace ProjectileTests
+{
+	void SetBatchedUpdate(bool bBatched)
+	{
+		if (IConsoleVariable* CVar = IConsoleManager::Get().FindConsoleVariable(TEXT("GP4.Projectiles.BatchedUpdate")))
+		{
+			CVar->Set(bBatched ? 1 : 0, ECVF_SetByCode);
+		}
+	}
+
+	ABullet* SpawnBullet(UWorld* World, const FVector& Location, const FRotator& Rotation, float Speed)
+	{
+		FActorSpawnParameters Params;
+		Params.SpawnCollisionHandlingOverride = ESpawnActorCollisionHandlingMethod::AlwaysSpawn;
+		ABullet* Bullet = World->SpawnActor<ABullet>(ABullet::StaticClass(), Location, Rotation, Params);
+		if (Bullet) Bullet->Init(nullptr, 1.f, Speed);
+		return Bullet;
+	}
+
+	// Instances across every instanced mesh in the world; the simulation's render actor is the only owner of any
+	int32 CountInstances(UWorld* World)
+	{
+		int32 Instances = 0;
+		for (TActorIterator<AActor> It(World); It; ++It)
+		{
+			TInlineComponentArray<UInstancedStaticMeshComponent*> Meshes(*It);
+			for (const UInstancedStaticMeshComponent* Mesh : Meshes) Instances += Mesh->GetInstanceCount();
+		}
+		return Instances;
+	}
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FProjectileBatchedUpdateTest, "GP4.Projectiles.BatchedUpdate.MovesAndUnregisters", EAutomationTestFlags::EditorContext | EAutomationTestFlags::EngineFilter)
+bool FProjectileBatchedUpdateTest::RunTest(const FString& Parameters)
+{
+	ProjectileTests::SetBatchedUpdate(true);
+	UWorld* World = GP4TestWorld::Create(TEXT("ProjectileTestWorld"));
+	{
+		UProjectileUpdateSubsystem* Subsystem = World->GetSubsystem<UProjectileUpdateSubsystem>();
+		TestNotNull(TEXT("Projectile update subsystem exists"), Subsystem);
+		if (Subsystem)
+		{
+			ABullet* A = ProjectileTests::SpawnBullet(World, FVector::ZeroVector, FRotator::ZeroRotator, 100.f);
+			ABullet* B = ProjectileTests::SpawnBullet(World, FVector(0, 500, 0), FRotator(0, 90, 0), 200.f);
+			TestEqual(TEXT("Init registers bullets"), Subsystem->GetNumRegistered(), 2);
+			TestFalse(TEXT("Registered bullets do not tick themselves"), A->IsActorTickEnabled());
+
+			Subsystem->Tick(0.5f);
+			TestTrue(TEXT("Bullet moves along its forward vector"), A->GetActorLocation().Equals(FVector(50, 0, 0), 0.01f));
+			TestTrue(TEXT("Each bullet uses its own speed"), B->GetActorLocation().Equals(FVector(0, 600, 0), 0.01f));
+
+			A->Destroy();
+			TestEqual(TEXT("Destroyed bullets unregister"), Subsystem->GetNumRegistered(), 1);
+
+			Subsystem->Tick(0.5f);
+			TestTrue(TEXT("Swap-removed bullet keeps its own data"), B->GetActorLocation().Equals(FVector(0, 700, 0), 0.01f));
+		}
+	}
+	GP4TestWorld::Destroy(World);
+	return true;
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FProjectileSweepHitTest, "GP4.Projectiles.SweepHit.NoTunnelingThroughThinCapsule", EAutomationTestFlags::EditorContext | EAutomationTestFlags::EngineFilter)
+bool FProjectileSweepHitTest::RunTest(const FString& Parameters)
+{
+	ProjectileTests::SetBatchedUpdate(true);
+	UWorld* World = GP4TestWorld::Create(TEXT("ProjectileTestWorld"));
+	{
+		// 2 uu thin target 500 uu ahead; one 1 second step at 10000 uu/s would jump straight past it
+		AActor* Target = World->SpawnActor<AActor>();
+		UCapsuleComponent* Capsule = NewObject<UCapsuleComponent>(Target);
+		Capsule->InitCapsuleSize(2.f, 50.f);
+		Capsule->SetCollisionProfileName(UCollisionProfile::BlockAll_ProfileName);
+		Target->SetRootComponent(Capsule);
+		Capsule->RegisterComponent();
+		Target->SetActorLocation(FVector(500, 0, 0));
+
+		ABullet* Bullet = World->SpawnActor<ABullet>(ABullet::StaticClass(), FTransform::Identity);
+		Bullet->SetHitDetection(EBulletHitDetection::Sweep);
+		Bullet->Init(nullptr, 1.f, 10000.f);
+
+		UProjectileUpdateSubsystem* Subsystem = World->GetSubsystem<UProjectileUpdateSubsystem>();
+		TestTrue(TEXT("Bullet uses sweep hit detection"), Bullet->UsesSweepHitDetection());
+		if (Subsystem)
+		{
+			Subsystem->Tick(1.f);
+			TestFalse(TEXT("Unpooled bullet is destroyed on hit instead of passing through"), IsValid(Bullet));
+			TestEqual(TEXT("Hit bullet is unregistered"), Subsystem->GetNumRegistered(), 0);
+		}
+	}
+	GP4TestWorld::Destroy(World);
+	return true;
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FProjectileOverlapHitTest, "GP4.Projectiles.BatchedUpdate.OverlapSweepsThinTarget", EAutomationTestFlags::EditorContext | EAutomationTestFlags::EngineFilter)
+bool FProjectileOverlapHitTest::RunTest(const FString& Parameters)
+{
+	ProjectileTests::SetBatchedUpdate(true);
+	UWorld* World = GP4TestWorld::Create(TEXT("ProjectileTestWorld"));
+	{
+		// Same thin target as the sweep test, but overlap-only, hit by an overlap bullet in a single step
+		AActor* Target = World->SpawnActor<AActor>();
+		UCapsuleComponent* Capsule = NewObject<UCapsuleComponent>(Target);
+		Capsule->InitCapsuleSize(2.f, 50.f);
+		Capsule->SetCollisionProfileName(TEXT("OverlapAll"));
+		Capsule->SetGenerateOverlapEvents(true);
+		Target->SetRootComponent(Capsule);
+		Capsule->RegisterComponent();
+		Target->SetActorLocation(FVector(500, 0, 0));
+
+		ABullet* Bullet = World->SpawnActor<ABullet>(ABullet::StaticClass(), FTransform::Identity);
+		UStaticMeshComponent* Mesh = Bullet->GetBulletMesh();
+		Mesh->SetStaticMesh(LoadObject<UStaticMesh>(nullptr, TEXT("/Engine/BasicShapes/Sphere.Sphere")));
+		Mesh->SetWorldScale3D(FVector(0.1f));
+		Mesh->SetCollisionProfileName(TEXT("OverlapAllDynamic"));
+		Mesh->SetGenerateOverlapEvents(true);
+		Bullet->Init(nullptr, 1.f, 10000.f);
+
+		UProjectileUpdateSubsystem* Subsystem = World->GetSubsystem<UProjectileUpdateSubsystem>();
+		TestFalse(TEXT("Bullet uses overlap hit detection"), Bullet->UsesSweepHitDetection());
+		if (Subsystem)
+		{
+			Subsystem->Tick(1.f);
+			TestFalse(TEXT("Overlap bullet hits the thin target instead of teleporting past it"), IsValid(Bullet));
+			TestEqual(TEXT("Hit bullet is unregistered"), Subsystem->GetNumRegistered(), 0);
+		}
+	}
+	GP4TestWorld::Destroy(World);
+	return true;
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FProjectileSimulationTest, "GP4.Projectiles.Simulation.HitsExpiresAndInstances", EAutomationTestFlags::EditorContext | EAutomationTestFlags::EngineFilter)
+bool FProjectileSimulationTest::RunTest(const FString& Parameters)
+{
+	using namespace ProjectileTests;
+
+	UWorld* World = GP4TestWorld::Create(TEXT("ProjectileTestWorld"));
+	{
+		UProjectileSimulationSubsystem* Simulation = World->GetSubsystem<UProjectileSimulationSubsystem>();
+		TestNotNull(TEXT("Projectile simulation subsystem exists"), Simulation);
+		if (Simulation)
+		{
+			// Damageable target with a box to sweep against, 500 units down +X
+			ACombatHitResolverTestTarget* Target = World->SpawnActor<ACombatHitResolverTestTarget>(FVector(500.f, 0.f, 0.f), FRotator::ZeroRotator);
+			UBoxComponent* Box = NewObject<UBoxComponent>(Target);
+			Box->InitBoxExtent(FVector(50.f));
+			Box->SetCollisionProfileName(UCollisionProfile::BlockAll_ProfileName);
+			Box->SetupAttachment(Target->GetRootComponent());
+			Box->RegisterComponent();
+			Simulation->OnProjectileHit.AddDynamic(Target, &ACombatHitResolverTestTarget::RecordHitEvent);
+
+			FProjectileSpawnParams Params;
+			Params.BulletClass = AProjectileTestBullet::StaticClass();
+			Params.Damage = 25.f;
+			Params.Speed = 10000.f;
+			Simulation->SpawnProjectile(Params);
+
+			// Second round flies away from everything and runs out of lifetime
+			Params.Direction = -FVector::ForwardVector;
+			Params.Lifetime = 0.25f;
+			Simulation->SpawnProjectile(Params);
+			TestEqual(TEXT("Both rounds are live"), Simulation->GetNumLiveProjectiles(), 2);
+
+			Simulation->Tick(0.1f);
+			TestEqual(TEXT("Target took one hit"), Target->DamageTaken, 1);
+			TestEqual(TEXT("Hit deals the round's damage"), Target->LastDamageValue, 25.f);
+			TestEqual(TEXT("OnProjectileHit fired once"), Target->HitEvents, 1);
+			TestTrue(TEXT("Payload names the target and the component hit"), Target->LastHitActor == Target && Target->LastOtherComp == Box);
+			TestNull(TEXT("Payload has no overlapped bullet component"), Target->LastOverlappedComp);
+			TestEqual(TEXT("Payload carries the damage"), Target->LastHitEventDamage, 25.f);
+			TestTrue(TEXT("Payload comes from a sweep"), Target->bLastHitFromSweep);
+			TestEqual(TEXT("Hit round is removed"), Simulation->GetNumLiveProjectiles(), 1);
+			TestEqual(TEXT("One instance per live round"), CountInstances(World), 1);
+
+			Simulation->Tick(0.1f);
+			TestEqual(TEXT("Round with lifetime left keeps flying"), Simulation->GetNumLiveProjectiles(), 1);
+
+			Simulation->Tick(0.1f);
+			TestEqual(TEXT("Expired round is removed"), Simulation->GetNumLiveProjectiles(), 0);
+			TestEqual(TEXT("Expired round's instance is removed"), CountInstances(World), 0);
+			TestEqual(TEXT("Expiry deals no damage"), Target->DamageTaken, 1);
+		}
+	}
+	GP4TestWorld::Destroy(World);
+	return true;
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FProjectileUpdateBenchmark, "GP4.Projectiles.Benchmark.BatchedVsPerActorTick", EAutomationTestFlags::EditorContext | EAutomationTestFlags::PerfFilter)
+bool FProjectileUpdateBenchmark::RunTest(const FString& Parameters)
+{
+	constexpr int32 Frames = 60;
+	constexpr float FrameTime = 1.f / 60.f;
+	const int32 BulletCounts[] = { 100, 1000, 5000 };
+
+	double LargestBatched = 0.0;
+	double LargestPerActor = 0.0;
+	for (const bool bBatched : { false, true })
+	{
+		for (const int32 Count : BulletCounts)
+		{
+			ProjectileTests::SetBatchedUpdate(bBatched);
+			UWorld* World = GP4TestWorld::Create(TEXT("ProjectileTestWorld"));
+
+			for (int32 i = 0; i < Count; ++i)
+			{
+				// Spread out and pointed away from each other so nothing overlaps
+				ProjectileTests::SpawnBullet(World, FVector(i * 100.f, 0, 0), FRotator(0, 90, 0), 1000.f);
+			}
+
+			const double Start = FPlatformTime::Seconds();
+			for (int32 Frame = 0; Frame < Frames; ++Frame)
+			{
+				World->Tick(LEVELTICK_All, FrameTime);
+			}
+			const double MsPerFrame = (FPlatformTime::Seconds() - Start) * 1000.0 / Frames;
+
+			AddInfo(FString::Printf(TEXT("%s %5d bullets: %.3f ms per frame"), bBatched ? TEXT("Batched  ") : TEXT("PerActor "), Count, MsPerFrame));
+			if (Count == BulletCounts[UE_ARRAY_COUNT(BulletCounts) - 1])
+			{
+				(bBatched ? LargestBatched : LargestPerActor) = MsPerFrame;
+			}
+
+			GP4TestWorld::Destroy(World);
+		}
+	}
+	ProjectileTests::SetBatchedUpdate(true);
+
+	TestTrue(TEXT("Batched update is cheaper than per-actor ticking at the largest count"), LargestBatched < LargestPerActor);
+	return true;
+}
@@ -0,0 +1,27 @@
+﻿// TestWorldHelpers.h - Shared world fixture for automation tests that need actors or subsystems
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Engine/Engine.h"
+#include "Engine/World.h"
+
+namespace GP4TestWorld
+{
+	// Minimal game world with play begun, so actors tick and world subsystems exist
+	inline UWorld* Create(const TCHAR* Name)
+	{
+		UWorld* World = UWorld::CreateWorld(EWorldType::Game, false, Name);
+		FWorldContext& WorldContext = GEngine->CreateNewWorldContext(EWorldType::Game);
+		WorldContext.SetCurrentWorld(World);
+		World->InitializeActorsForPlay(FURL());
+		World->BeginPlay();
+		return World;
+	}
+
+	inline void Destroy(UWorld* World)
+	{
+		GEngine->DestroyWorldContext(World);
+		World->DestroyWorld(false);
+	}
+}
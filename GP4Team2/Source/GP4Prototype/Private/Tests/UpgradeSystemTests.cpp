@@ -2,6 +2,7 @@
 
 #include "Misc/AutomationTest.h"
 #include "Systems/AttributeSystem/AttributeComponent.h"
+#include "Systems/AttributeSystem/AttributeTags.h"
 #include "Systems/UpgradeSystem/RarityData.h"
 #include "Systems/UpgradeSystem/UpgradeCardData.h"
 #include "Systems/UpgradeSystem/UpgradeManagerComponent.h"
@@ -12,7 +13,7 @@ bool FAttributeRecalculationTest::RunTest(const FString& Parameters)
 	UAttributeComponent* Comp = NewObject<UAttributeComponent>(GetTransientPackage());
 
 	// Register and use a test tag
-	FAttribute& Attr = Comp->RegisterAndGetAttribute(TEXT("Attribute.Test"), TEXT("Test attribute"));
+	Comp->RegisterAndGetAttribute(TEXT("Attribute.Test"), TEXT("Test attribute"));
 	FGameplayTag Tag = FGameplayTag::RequestGameplayTag(FName(TEXT("Attribute.Test")));
 	Comp->SetAttributeBaseValue(Tag, 10.f);
 
@@ -95,7 +96,7 @@ IMPLEMENT_SIMPLE_AUTOMATION_TEST(FAttributeIntegerTypeRoundingTest, "GP4.Attribu
 bool FAttributeIntegerTypeRoundingTest::RunTest(const FString& Parameters)
 {
 	UAttributeComponent* Comp = NewObject<UAttributeComponent>(GetTransientPackage());
-	FAttribute& Attr = Comp->RegisterAndGetAttribute(TEXT("Attribute.IntTest"), TEXT("Int attribute test"));
+	Comp->RegisterAndGetAttribute(TEXT("Attribute.IntTest"), TEXT("Int attribute test"));
 	FGameplayTag Tag = FGameplayTag::RequestGameplayTag(FName(TEXT("Attribute.IntTest")));
 	Comp->SetAttributeBaseValue(Tag, 10.0f);
 	Comp->SetAttributeNumericType(Tag, EAttributeNumericType::Integer);
@@ -113,3 +114,112 @@ bool FAttributeIntegerTypeRoundingTest::RunTest(const FString& Parameters)
 
 	return true;
 }
+
+namespace UpgradeSystemTests
+{
+	// Full-scan recalculation the cached aggregates must reproduce exactly (clamp/rounding left out: they run after)
+	float ScanModifiers(const FAttribute& Attr)
+	{
+		float AdditiveSum = 0.0f;
+		float MultiplicativeFactor = 1.0f;
+		TOptional<float> OverrideValue;
+		for (const FModifier& M : Attr.ActiveModifiers)
+		{
+			switch (M.Type)
+			{
+			case EModificationType::Addition: AdditiveSum += M.Value; break;
+			case EModificationType::Subtraction: AdditiveSum -= M.Value; break;
+			case EModificationType::Multiplication: MultiplicativeFactor *= M.Value; break;
+			case EModificationType::Override: OverrideValue = M.Value; break;
+			}
+		}
+		const float Value = (Attr.BaseValue + AdditiveSum) * MultiplicativeFactor;
+		return OverrideValue.IsSet() ? OverrideValue.GetValue() : Value;
+	}
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FAttributeAggregateMatchesScanTest, "GP4.Attribute.Recalculate.AggregatesMatchFullScan", EAutomationTestFlags::EditorContext | EAutomationTestFlags::EngineFilter)
+bool FAttributeAggregateMatchesScanTest::RunTest(const FString& Parameters)
+{
+	// Random add/remove/clear sequences with values that are not exactly representable, compared bit for bit
+	constexpr int32 Sequences = 200;
+	constexpr int32 OpsPerSequence = 100;
+	FRandomStream Rand(2024);
+
+	int32 Mismatches = 0;
+	for (int32 Seq = 0; Seq < Sequences && Mismatches == 0; ++Seq)
+	{
+		FAttribute Attr;
+		Attr.BaseValue = Rand.FRandRange(-50.f, 500.f);
+
+		for (int32 Op = 0; Op < OpsPerSequence; ++Op)
+		{
+			const float Roll = Rand.FRand();
+			if (Roll < 0.6f || Attr.ActiveModifiers.Num() == 0)
+			{
+				FModifier M;
+				M.ModifierID = FGuid::NewGuid();
+				M.Type = static_cast<EModificationType>(Rand.RandRange(0, 3));
+				M.Value = M.Type == EModificationType::Multiplication ? Rand.FRandRange(0.5f, 1.7f) : Rand.FRandRange(-10.f, 10.f);
+				Attr.AddModifier(M);
+			}
+			else if (Roll < 0.97f)
+			{
+				const FGuid Victim = Attr.ActiveModifiers[Rand.RandRange(0, Attr.ActiveModifiers.Num() - 1)].ModifierID;
+				Attr.RemoveModifiers([&](const FModifier& M){ return M.ModifierID == Victim; });
+			}
+			else
+			{
+				Attr.ClearModifiers();
+			}
+
+			Attr.Recalculate();
+			if (Attr.Value != UpgradeSystemTests::ScanModifiers(Attr))
+			{
+				++Mismatches;
+				AddError(FString::Printf(TEXT("Sequence %d op %d: cached %.9g vs scan %.9g"), Seq, Op, Attr.Value, UpgradeSystemTests::ScanModifiers(Attr)));
+				break;
+			}
+		}
+
+		// Rebuilding on demand gives the same result
+		const float Cached = Attr.Value;
+		Attr.RebuildAggregates();
+		Attr.Recalculate();
+		TestTrue(TEXT("On-demand rebuild matches cached value"), Attr.Value == Cached);
+	}
+
+	TestEqual(TEXT("Cached aggregates never diverge from a full scan"), Mismatches, 0);
+	return true;
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FAttributeBatchCoalescesTest, "GP4.Attribute.Batch.CoalescesRecalculation", EAutomationTestFlags::EditorContext | EAutomationTestFlags::EngineFilter)
+bool FAttributeBatchCoalescesTest::RunTest(const FString& Parameters)
+{
+	UAttributeComponent* Comp = NewObject<UAttributeComponent>(GetTransientPackage());
+	const FGameplayTag Tag = AttributeTags::Attribute_MaxHealth;
+	Comp->SetAttributeBaseValue(Tag, 100.f);
+
+	Comp->BeginBatch();
+	for (int32 i = 0; i < 5; ++i)
+	{
+		FModifier Add; Add.Type = EModificationType::Addition; Add.Value = 10.f;
+		Comp->AddModifier(Tag, Add);
+	}
+	TestEqual(TEXT("Value is deferred inside a batch"), Comp->GetAttributeValue(Tag), 100.f);
+	TestEqual(TEXT("Base stays readable inside a batch"), Comp->GetAttributeBaseValue(EAttributeId::MaxHealth), 100.f);
+	Comp->EndBatch();
+
+	TestEqual(TEXT("Batch applies every modifier"), Comp->GetAttributeValue(Tag), 150.f);
+	TestEqual(TEXT("Five changes coalesce into one event pair"), Comp->GetBroadcastsSaved(), 8);
+	TestFalse(TEXT("Batch closed"), Comp->IsBatching());
+
+	// A direct set inside a batch wins over modifiers added before it, as it would unbatched
+	Comp->BeginBatch();
+	FModifier Mul; Mul.Type = EModificationType::Multiplication; Mul.Value = 2.f;
+	Comp->AddModifier(Tag, Mul);
+	Comp->SetAttributeValue(Tag, 42.f);
+	Comp->EndBatch();
+	TestEqual(TEXT("Direct set survives EndBatch"), Comp->GetAttributeValue(Tag), 42.f);
+	return true;
+}
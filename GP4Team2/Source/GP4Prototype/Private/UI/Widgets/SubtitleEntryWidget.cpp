@@ -4,6 +4,7 @@
 #include "UI/Widgets/SubtitleEntryWidget.h"
 #include "Animation/WidgetAnimation.h"
 #include "TimerManager.h"
+#include "UI/Widgets/SubtitleWidget.h"
 
 void USubtitleEntryWidget::PlayFadeOutAndDestroy()
 {
@@ -19,15 +20,9 @@ void USubtitleEntryWidget::PlayFadeOutAndDestroy()
 		{
 			if (EndTime > KINDA_SMALL_NUMBER)
 			{
-				FTimerHandle Handle;
+				// Kept so a release before the fade ends can cancel it; a reused entry must not be removed by an old timer
 				World->GetTimerManager().SetTimer(
-					Handle, [this]()
-					{
-						if (IsValid(this))
-						{
-							RemoveFromParent();
-						}
-					},
+					FadeOutTimerHandle, FTimerDelegate::CreateUObject(this, &USubtitleEntryWidget::FinishFadeOut),
 					EndTime, false);
 			}
 		}
@@ -35,6 +30,25 @@ void USubtitleEntryWidget::PlayFadeOutAndDestroy()
 	else
 	{
 		// No animation, remove immediately
-		RemoveFromParent();
+		FinishFadeOut();
 	}
 }
+
+void USubtitleEntryWidget::OnReleased_Implementation()
+{
+	if (UWorld* World = GetWorld())
+	{
+		World->GetTimerManager().ClearTimer(FadeOutTimerHandle);
+	}
+	StopAllAnimations();
+}
+
+void USubtitleEntryWidget::FinishFadeOut()
+{
+	if (USubtitleWidget* Owner = OwningSubtitleWidget.Get())
+	{
+		Owner->ReleaseEntry(this);
+		return;
+	}
+	RemoveFromParent();
+}
@@ -9,7 +9,7 @@ USubtitleEntryWidget* USubtitleWidget::AddSubtitle(const FText& Speaker, const F
 {
 	if (!EntryClass || !SubtitleBox) return nullptr;
 
-	USubtitleEntryWidget* Entry = CreateWidget<USubtitleEntryWidget>(this, EntryClass);
+	USubtitleEntryWidget* Entry = AcquireEntry();
 	if (Entry)
 	{
 		Entry->SetupEntry(Speaker, Line);
@@ -18,17 +18,80 @@ USubtitleEntryWidget* USubtitleWidget::AddSubtitle(const FText& Speaker, const F
 	return Entry;
 }
 
-void USubtitleWidget::CullOldEntries() const
+void USubtitleWidget::CullOldEntries()
 {
 	if (!SubtitleBox) return;
 	while (SubtitleBox->GetChildrenCount() > MaxEntryAmount)
 	{
-		SubtitleBox->RemoveChildAt(0);
+		ReleaseEntry(Cast<USubtitleEntryWidget>(SubtitleBox->GetChildAt(0)));
 	}
 }
 
 void USubtitleWidget::ClearAllSubtitles()
 {
 	if (!SubtitleBox) return;
+	for (int32 i = SubtitleBox->GetChildrenCount() - 1; i >= 0; --i)
+	{
+		if (USubtitleEntryWidget* Entry = Cast<USubtitleEntryWidget>(SubtitleBox->GetChildAt(i)))
+		{
+			ReleaseEntry(Entry);
+		}
+	}
 	SubtitleBox->ClearChildren();
 }
+
+void USubtitleWidget::ReleaseEntry(USubtitleEntryWidget* Entry)
+{
+	if (!Entry)
+	{
+		// Non-entry child at the front of the box; drop it so culling always makes progress
+		if (SubtitleBox && SubtitleBox->GetChildrenCount() > 0) SubtitleBox->RemoveChildAt(0);
+		return;
+	}
+
+	// Release runs the reset functor, which takes the entry out of the box
+	if (EntryPool && EntryPool->Release(Entry)) return;
+	Entry->RemoveFromParent();
+}
+
+USubtitleEntryWidget* USubtitleWidget::AcquireEntry()
+{
+	if (!EntryPool)
+	{
+		EntryPool = MakeUnique<TObjectPool<USubtitleEntryWidget>>(
+			[this]() -> USubtitleEntryWidget*
+			{
+				USubtitleEntryWidget* Entry = CreateWidget<USubtitleEntryWidget>(this, EntryClass);
+				if (Entry) Entry->OwningSubtitleWidget = this;
+				return Entry;
+			},
+			[](USubtitleEntryWidget* Entry, bool bActive)
+			{
+				if (bActive)
+				{
+					Entry->SetRenderOpacity(1.f);
+					return;
+				}
+				Entry->RemoveFromParent();
+			},
+			FMath::CeilToInt32(MaxEntryAmount) + EntryPoolSize);
+	}
+
+	USubtitleEntryWidget* Entry = EntryPool->Acquire();
+	if (!Entry && EntryPool->Grow(1) > 0)
+	{
+		Entry = EntryPool->Acquire();
+	}
+	return Entry;
+}
+
+void USubtitleWidget::AddReferencedObjects(UObject* InThis, FReferenceCollector& Collector)
+{
+	Super::AddReferencedObjects(InThis, Collector);
+
+	USubtitleWidget* This = CastChecked<USubtitleWidget>(InThis);
+	if (This->EntryPool)
+	{
+		This->EntryPool->AddReferencedObjects(Collector, This);
+	}
+}
@@ -21,6 +21,18 @@ public:
 	UFUNCTION(BlueprintPure, Category="LookTrace")
 	bool DoesDrawDebug();
 
+	UFUNCTION(BlueprintPure, Category="LookTrace")
+	bool IsCameraTraceCacheEnabled();
+
+	UFUNCTION(BlueprintPure, Category="LookTrace")
+	float GetCameraTraceCacheLocationTolerance();
+
+	UFUNCTION(BlueprintPure, Category="LookTrace")
+	float GetCameraTraceCacheAngleToleranceDegrees();
+
+	UFUNCTION(BlueprintPure, Category="LookTrace")
+	int32 GetCameraTraceCacheMaxFrameAge();
+
 protected:
 	//Variables --> Edit
 	UPROPERTY(EditAnywhere, Config, Category="Interaction")
@@ -31,4 +43,19 @@ protected:
 
 	UPROPERTY(EditAnywhere, Config, Category="Interaction")
 	bool bDrawTraceDebug = false;
+
+	// Identical camera traces (same controller, channel, length, radius) reuse one physics query
+	UPROPERTY(EditAnywhere, Config, Category="Camera Trace Cache")
+	bool bEnableCameraTraceCache = true;
+
+	// How far the view point may move before a cached result is traced again
+	UPROPERTY(EditAnywhere, Config, Category="Camera Trace Cache", meta=(ClampMin="0.0", EditCondition="bEnableCameraTraceCache"))
+	float CameraTraceCacheLocationTolerance = 1.0f;
+
+	UPROPERTY(EditAnywhere, Config, Category="Camera Trace Cache", meta=(ClampMin="0.0", EditCondition="bEnableCameraTraceCache"))
+	float CameraTraceCacheAngleToleranceDegrees = 0.1f;
+
+	// 0 serves only the frame the trace was made in; higher values let a still camera reuse results across frames
+	UPROPERTY(EditAnywhere, Config, Category="Camera Trace Cache", meta=(ClampMin="0", EditCondition="bEnableCameraTraceCache"))
+	int32 CameraTraceCacheMaxFrameAge = 0;
 };
@@ -0,0 +1,11 @@
+#pragma once
+
+#include "CoreMinimal.h"
+#include "BulletSimulationMode.generated.h"
+
+UENUM(BlueprintType)
+enum class EBulletSimulationMode : uint8
+{
+	Actor      UMETA(DisplayName = "Actor", ToolTip = "Every shot is a pooled ABullet actor"),
+	Simulated  UMETA(DisplayName = "Simulated", ToolTip = "Shots are plain structs advanced by UProjectileSimulationSubsystem")
+};
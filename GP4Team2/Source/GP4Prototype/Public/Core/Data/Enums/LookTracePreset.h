@@ -0,0 +1,16 @@
+#pragma once
+
+#include "CoreMinimal.h"
+#include "LookTracePreset.generated.h"
+
+UENUM(BlueprintType)
+enum class ELookTracePreset : uint8
+{
+	Default      UMETA(DisplayName = "Default", ToolTip = "No ignore list; one-off queries"),
+	PlayerAim    UMETA(DisplayName = "Player Aim", ToolTip = "Camera traces; ignores the pawn and its owner"),
+	VaultProbe   UMETA(DisplayName = "Vault Probe", ToolTip = "Forward probes for vaultables; ignores the pawn"),
+	GroundProbe  UMETA(DisplayName = "Ground Probe", ToolTip = "Downward probes; ignores the pawn"),
+	Melee        UMETA(DisplayName = "Melee", ToolTip = "Bat swings and dash/slide hits; ignores the pawn"),
+
+	MAX          UMETA(Hidden)
+};
@@ -0,0 +1,13 @@
+#pragma once
+
+#include "CoreMinimal.h"
+#include "MovementProbe.generated.h"
+
+UENUM(BlueprintType)
+enum class EMovementProbe : uint8
+{
+	DashVault    UMETA(DisplayName = "Dash Vault", ToolTip = "Forward vaultable probe while dashing"),
+	SprintVault  UMETA(DisplayName = "Sprint Vault", ToolTip = "Forward vaultable probe while sprinting"),
+
+	MAX          UMETA(Hidden)
+};
@@ -0,0 +1,81 @@
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Core/Data/Enums/LookTracePreset.h"
+#include "Engine/EngineTypes.h"
+
+enum class ELookTraceShape : uint8
+{
+	Sphere,
+	Capsule
+};
+
+// One physics query issued through ULookTraceSubsystem while a capture runs
+struct FLookTraceRecord
+{
+	uint64 Frame = 0;
+	FName Caller;
+	ELookTracePreset Preset = ELookTracePreset::Default;
+	ELookTraceShape Shape = ELookTraceShape::Sphere;
+	TEnumAsByte<ECollisionChannel> Channel = ECC_Visibility;
+	float Length = 0.f;
+	float Radius = 0.f;
+
+	// INDEX_NONE for async requests; their result arrives after the record is taken
+	int32 Hits = 0;
+	double Microseconds = 0.0;
+};
+
+struct FLookTraceCallerStats
+{
+	FName Caller;
+	int32 Traces = 0;
+	int32 Hits = 0;
+	double TotalMicroseconds = 0.0;
+	double PeakFrameMicroseconds = 0.0;
+	int32 FramesActive = 0;
+
+	// Running sum for the frame being recorded; folded into the peak when the frame changes
+	double CurrentFrameMicroseconds = 0.0;
+	uint64 CurrentFrame = 0;
+};
+
+/**
+ * Records every trace of ULookTraceSubsystem during a capture and aggregates them per caller (the gameplay code that
+ * named itself with FLookTraceCallerScope, else the subsystem entry point). Averages are per captured frame, so callers
+ * that only trace now and then still compare fairly against per-tick ones. Exports raw records and the per-caller
+ * summary as CSV to Saved/Profiling.
+ */
+class GP4PROTOTYPE_API FLookTraceProfiler
+{
+public:
+	void StartCapture();
+	void StopCapture();
+	bool IsCapturing() const { return bCapturing; }
+
+	void Record(const FLookTraceRecord& Record);
+
+	// Callers sorted by average microseconds per captured frame, most expensive first
+	void GetTopCallers(int32 Count, TArray<FLookTraceCallerStats>& OutCallers) const;
+
+	int32 GetNumCapturedFrames() const;
+	int32 GetNumRecords() const { return Records.Num(); }
+
+	FString BuildRecordsCsv() const;
+	FString BuildCallersCsv() const;
+
+	// Writes LookTraceCapture-<time>.csv and LookTraceCallers-<time>.csv; OutPath is the records file
+	bool ExportCapture(FString& OutPath) const;
+
+private:
+	// Raw records stop here (~16 MB); aggregates keep counting
+	static constexpr int32 MaxRecords = 1 << 18;
+
+	bool bCapturing = false;
+	uint64 StartFrame = 0;
+	uint64 LastFrame = 0;
+	int32 DroppedRecords = 0;
+
+	TArray<FLookTraceRecord> Records;
+	TMap<FName, FLookTraceCallerStats> Callers;
+};
@@ -1,41 +1,144 @@
 #pragma once
 
 #include "CoreMinimal.h"
+#include "Containers/StaticArray.h"
+#include "Core/Data/Enums/LookTracePreset.h"
+#include "Core/Subsystems/LookTraceProfiler.h"
 #include "Subsystems/LocalPlayerSubsystem.h"
+#include "Tickable.h"
+#include "WorldCollision.h"
 #include "LookTraceSubsystem.generated.h"
 
 
 class ULookTraceSettings;
 
+// Caller-owned hit buffer for multi-hit queries. Physics multi-sweeps only fill default-allocator arrays, so the sweep
+// writes straight into this; keep it as a member and it stops allocating once the first frame has sized it
+using FTraceHitBuffer = TArray<FHitResult>;
+
+// Ticket for an async trace; results arrive the frame after the request
+USTRUCT(BlueprintType)
+struct FLookTraceHandle
+{
+	GENERATED_BODY()
+
+	UPROPERTY()
+	int32 Id = 0;
+
+	bool IsValid() const { return Id != 0; }
+	void Invalidate() { Id = 0; }
+};
+
 UCLASS()
-class GP4PROTOTYPE_API ULookTraceSubsystem : public ULocalPlayerSubsystem
+class GP4PROTOTYPE_API ULookTraceSubsystem : public ULocalPlayerSubsystem, public FTickableGameObject
 {
 	GENERATED_BODY()
 
 public:
+	ULookTraceSubsystem();
+
+	// FTickableGameObject: only ticks during a trace capture, to draw the top-N overlay
+	virtual void Tick(float DeltaTime) override;
+	virtual bool IsTickable() const override { return Profiler.IsCapturing(); }
+	virtual ETickableTickType GetTickableTickType() const override { return IsTemplate() ? ETickableTickType::Never : ETickableTickType::Conditional; }
+	virtual TStatId GetStatId() const override { RETURN_QUICK_DECLARE_CYCLE_STAT(ULookTraceSubsystem, STATGROUP_Tickables); }
+
+	// Trace capture: every query is recorded with caller, shape, channel, length, hits and time.
+	// Console: GP4.LookTrace.StartCapture / GP4.LookTrace.StopCapture (exports) / GP4.LookTrace.ExportCapture
+	UFUNCTION(BlueprintCallable, Category="LookTrace|Profiling")
+	void StartTraceCapture();
+
+	// Stops recording and writes the capture to Saved/Profiling
+	UFUNCTION(BlueprintCallable, Category="LookTrace|Profiling")
+	void StopTraceCapture();
+
+	UFUNCTION(BlueprintCallable, Category="LookTrace|Profiling")
+	bool ExportTraceCapture();
+
+	UFUNCTION(BlueprintPure, Category="LookTrace|Profiling")
+	bool IsCapturingTraces() const { return Profiler.IsCapturing(); }
+
+	const FLookTraceProfiler& GetProfiler() const { return Profiler; }
+
+	// Query presets: prebuilt FCollisionQueryParams (stat tag + ignore list) per ELookTracePreset, built around one pawn.
+	// Every trace takes a preset; pawn-based traces register their pawn on the fly, the rest use the last registered one.
+	// Re-registering the same pawn is a pointer compare, a new pawn (respawn) rebuilds the ignore lists.
+	void RegisterQueryPresets(const APawn* Pawn);
+
+	// Physics queries issued per preset and the game-thread time spent in them since the last reset
+	UFUNCTION(BlueprintPure, Category="LookTrace")
+	void GetPresetQueryStats(ELookTracePreset Preset, int32& OutQueries, float& OutMilliseconds) const;
+
+	UFUNCTION(BlueprintCallable, Category="LookTrace")
+	void ResetPresetQueryStats();
+
 	//Methods
 	UFUNCTION()
-	FHitResult GetHitResultFromCameraSphereTrace(AController* Controller, float TraceLength, float TraceRadius, ECollisionChannel TraceChannel);
+	FHitResult GetHitResultFromCameraSphereTrace(AController* Controller, float TraceLength, float TraceRadius, ECollisionChannel TraceChannel, ELookTracePreset Preset);
 
 	UFUNCTION()
-	FHitResult GetHitResultFromPawnForwardSphereTrace(APawn* Pawn, float TraceLength, float TraceRadius, ECollisionChannel TraceChannel);
+	FHitResult GetHitResultFromPawnForwardSphereTrace(APawn* Pawn, float TraceLength, float TraceRadius, ECollisionChannel TraceChannel, ELookTracePreset Preset);
 
 	UFUNCTION()
-	FHitResult GetHitResultFromPawnForwardSphereTraceWithOffset(float ForwardOffset, APawn* Pawn, float TraceLength, float TraceRadius, ECollisionChannel TraceChannel);
+	FHitResult GetHitResultFromPawnForwardSphereTraceWithOffset(float ForwardOffset, APawn* Pawn, float TraceLength, float TraceRadius, ECollisionChannel TraceChannel, ELookTracePreset Preset);
 
 	UFUNCTION()
-	FHitResult GetHitResultFromPawnDownSphereTrace(APawn* Pawn, float TraceLength, float TraceRadius, ECollisionChannel TraceChannel);
+	FHitResult GetHitResultFromPawnDownSphereTrace(APawn* Pawn, float TraceLength, float TraceRadius, ECollisionChannel TraceChannel, ELookTracePreset Preset);
 
 	UFUNCTION()
 	void GetHitResultFromCapsuleSweep(UPrimitiveComponent* BatComp, FVector& CurrentBase, FVector& CurrentTip, FVector& PrevBase,
-											FVector& PrevTip, float Radius, TArray<FHitResult>& OutHits, ECollisionChannel TraceChannel);
+											FVector& PrevTip, float Radius, TArray<FHitResult>& OutHits, ECollisionChannel TraceChannel, ELookTracePreset Preset);
+
+	// Swept blade: the segment PrevBase-PrevTip moving to CurrentBase-CurrentTip, covered by one capsule sweep per substep
+	// (substeps follow the tip's arc). The capsule reaches Radius past the base and the tip. When the swing needs more
+	// than MaxBladeSubsteps, a sphere sweep along the tip's path is added so the tip stays exact. Hits are deduplicated
+	// per component, earliest kept, into OutHits. IgnoredActor is skipped on top of the preset's ignore list. The internal
+	// scratch buffers and a reused OutHits keep this allocation free after the first swing.
+	void SweepBlade(ELookTracePreset Preset, const FVector& PrevBase, const FVector& PrevTip, const FVector& CurrentBase,
+					const FVector& CurrentTip, float Radius, ECollisionChannel TraceChannel, TArray<FHitResult>& OutHits,
+					const AActor* IgnoredActor = nullptr);
 	
 	UFUNCTION()
-	FVector GetLocationFromCameraLineTrace(AController* Controller, float TraceLength, float TraceRadius, ECollisionChannel TraceChannel);
+	FVector GetLocationFromCameraLineTrace(AController* Controller, float TraceLength, float TraceRadius, ECollisionChannel TraceChannel, ELookTracePreset Preset);
 
 	// from location and with direction
 	UFUNCTION()
-	TArray<FHitResult> GetHitResultFromLocationWithDirectionSphereTrace(FVector Forward, FVector StartLocation, float TraceLength, float TraceRadius, ECollisionChannel TraceChannel);
+	TArray<FHitResult> GetHitResultFromLocationWithDirectionSphereTrace(FVector Forward, FVector StartLocation, float TraceLength, float TraceRadius, ECollisionChannel TraceChannel, ELookTracePreset Preset);
+
+	// Same query into a caller-supplied buffer (reset first, capacity kept). Prefer this in per-frame code: keep the buffer as a member
+	bool SphereTraceFromLocationWithDirection(const FVector& Forward, const FVector& StartLocation, float TraceLength, float TraceRadius,
+											  ECollisionChannel TraceChannel, ELookTracePreset Preset, FTraceHitBuffer& OutHits);
+
+	// Async variants: queued on the world's async trace batch, which dispatches every request of the frame together.
+	// Results are readable from the next frame through ConsumeAsyncTrace; callers that can live with one frame of latency
+	// (vault probes, aim point) keep one handle and poll it every tick with PollAsyncTrace.
+	FLookTraceHandle RequestCameraSphereTraceAsync(AController* Controller, float TraceLength, float TraceRadius, ECollisionChannel TraceChannel, ELookTracePreset Preset);
+	FLookTraceHandle RequestPawnForwardSphereTraceAsync(APawn* Pawn, float TraceLength, float TraceRadius, ECollisionChannel TraceChannel, ELookTracePreset Preset, float ForwardOffset = 0.f);
+	FLookTraceHandle RequestPawnDownSphereTraceAsync(APawn* Pawn, float TraceLength, float TraceRadius, ECollisionChannel TraceChannel, ELookTracePreset Preset);
+	FLookTraceHandle RequestSphereSweepAsync(const FVector& Start, const FVector& End, float TraceRadius, ECollisionChannel TraceChannel, ELookTracePreset Preset);
+
+	bool IsAsyncTraceReady(const FLookTraceHandle& Handle) const;
+
+	// True once the result has arrived; copies it out and frees the handle. False while pending or for unknown handles
+	bool ConsumeAsyncTrace(FLookTraceHandle& Handle, FHitResult& OutHit);
+
+	// Drops a request whose result is no longer wanted (state exit)
+	void CancelAsyncTrace(FLookTraceHandle& Handle);
+
+	// Keeps exactly one request in flight on Handle: consumes a finished result into OutHit (returns true), and calls
+	// Request for a new handle only once the previous one is consumed or gone, never while it is still pending
+	template <typename RequestFuncType>
+	bool PollAsyncTrace(FLookTraceHandle& Handle, FHitResult& OutHit, RequestFuncType&& Request);
+
+	// Requests issued and not yet consumed, cancelled or pruned
+	int32 GetNumPendingAsyncTraces() const { return AsyncTraces.Num(); }
+
+	// Camera trace cache counters since the last reset
+	UFUNCTION(BlueprintPure, Category="LookTrace")
+	void GetCameraTraceCacheStats(int32& OutHits, int32& OutMisses) const { OutHits = CameraCacheHits; OutMisses = CameraCacheMisses; }
+
+	UFUNCTION(BlueprintCallable, Category="LookTrace")
+	void ResetCameraTraceCacheStats() { CameraCacheHits = 0; CameraCacheMisses = 0; }
 
 protected:
 	virtual void Initialize(FSubsystemCollectionBase& Collection) override;
@@ -43,4 +146,125 @@ protected:
 	//Variables
 	UPROPERTY()
 	ULookTraceSettings* LookTraceSettings;
+
+private:
+	static constexpr int32 NumQueryPresets = static_cast<int32>(ELookTracePreset::MAX);
+
+	struct FPresetQueryStats
+	{
+		int32 Queries = 0;
+		uint64 Cycles = 0;
+	};
+
+	// Counts and times the physics queries issued in its scope against a preset, hands out the preset's params and,
+	// while capturing, records the query for the profiler. Set NumHits before the scope closes
+	struct FScopedPresetQuery
+	{
+		FScopedPresetQuery(ULookTraceSubsystem& InSubsystem, ELookTracePreset InPreset, const TCHAR* InEntryPoint, ELookTraceShape InShape,
+						   ECollisionChannel InChannel, float InLength, float InRadius);
+		~FScopedPresetQuery();
+
+		const FCollisionQueryParams& Params;
+		int32 NumHits = 0;
+
+	private:
+		ULookTraceSubsystem& Subsystem;
+		FPresetQueryStats& Stats;
+		ELookTracePreset Preset;
+		const TCHAR* EntryPoint;
+		ELookTraceShape Shape;
+		ECollisionChannel Channel;
+		float Length;
+		float Radius;
+		uint64 StartCycles;
+	};
+
+	friend struct FLookTraceCallerScope;
+
+	FLookTraceProfiler Profiler;
+
+	// Set by FLookTraceCallerScope; profiler records fall back to the entry point name without one
+	const TCHAR* CurrentCaller = nullptr;
+
+	TWeakObjectPtr<const APawn> PresetPawn;
+	bool bQueryPresetsBuilt = false;
+	TStaticArray<FCollisionQueryParams, NumQueryPresets> PresetParams;
+	TStaticArray<FPresetQueryStats, NumQueryPresets> PresetStats;
+
+	// One camera sweep result, reusable while the view point stays within the settings' tolerances
+	struct FCameraTraceCacheEntry
+	{
+		TObjectKey<AController> Controller;
+		TEnumAsByte<ECollisionChannel> TraceChannel = ECC_Visibility;
+		float TraceLength = 0.f;
+		float TraceRadius = 0.f;
+		ELookTracePreset Preset = ELookTracePreset::Default;
+
+		FVector ViewLocation = FVector::ZeroVector;
+		FVector ViewDirection = FVector::ForwardVector;
+		uint64 Frame = 0;
+
+		FHitResult Hit;
+		bool bHit = false;
+	};
+
+	// Shared body of the camera traces; serves from the cache when allowed
+	const FCameraTraceCacheEntry* TraceFromCamera(AController* Controller, float TraceLength, float TraceRadius, ECollisionChannel TraceChannel, ELookTracePreset Preset);
+
+	// A handful of entries at most (aim, interaction), so a linear scan beats hashing
+	static constexpr int32 MaxCameraCacheEntries = 8;
+	TArray<FCameraTraceCacheEntry, TInlineAllocator<MaxCameraCacheEntries>> CameraTraceCache;
+	int32 CameraCacheHits = 0;
+	int32 CameraCacheMisses = 0;
+
+	// Upper bound on blade substeps; a full swing in one frame still resolves to this many queries
+	static constexpr int32 MaxBladeSubsteps = 8;
+	TArray<FHitResult> BladeSweepScratch;
+	// Preset params plus SweepBlade's IgnoredActor; the ignore lists are inline, so refilling it does not allocate
+	FCollisionQueryParams BladeParams;
+	TSet<const UPrimitiveComponent*> BladeSeenComponents;
+
+	struct FPendingAsyncTrace
+	{
+		FHitResult Hit;
+		uint64 RequestFrame = 0;
+		bool bDone = false;
+	};
+
+	void OnAsyncTraceDone(const FTraceHandle& TraceHandle, FTraceDatum& TraceDatum);
+	void PruneStaleAsyncTraces();
+
+	// Our id -> result slot. The id rides along as the trace's user data
+	TMap<int32, FPendingAsyncTrace> AsyncTraces;
+	int32 NextAsyncTraceId = 1;
+	FTraceDelegate AsyncTraceDelegate;
 };
+
+// Names the gameplay code issuing traces within the scope (e.g. TEXT("DashState.DashHit")) for the trace profiler.
+// Costs a pointer swap; the name is only resolved while a capture runs
+struct FLookTraceCallerScope
+{
+	FLookTraceCallerScope(ULookTraceSubsystem* InSubsystem, const TCHAR* Caller)
+		: Subsystem(InSubsystem)
+		, PreviousCaller(InSubsystem ? InSubsystem->CurrentCaller : nullptr)
+	{
+		if (Subsystem) Subsystem->CurrentCaller = Caller;
+	}
+
+	~FLookTraceCallerScope()
+	{
+		if (Subsystem) Subsystem->CurrentCaller = PreviousCaller;
+	}
+
+private:
+	ULookTraceSubsystem* Subsystem;
+	const TCHAR* PreviousCaller;
+};
+
+template <typename RequestFuncType>
+bool ULookTraceSubsystem::PollAsyncTrace(FLookTraceHandle& Handle, FHitResult& OutHit, RequestFuncType&& Request)
+{
+	const bool bConsumed = Handle.IsValid() && ConsumeAsyncTrace(Handle, OutHit);
+	if (!Handle.IsValid()) Handle = Request();
+	return bConsumed;
+}
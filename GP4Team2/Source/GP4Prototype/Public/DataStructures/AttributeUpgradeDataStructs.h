@@ -151,6 +151,38 @@ struct FModifier
 	FModifierRule Rules;
 };
 
+// Running aggregate of an attribute's modifiers, folded in ActiveModifiers order
+struct FAttributeAggregate
+{
+	float AdditiveSum = 0.0f;
+	float MultiplicativeFactor = 1.0f;
+	float OverrideValue = 0.0f;
+	bool bHasOverride = false;
+
+	void Fold(const FModifier& M)
+	{
+		switch (M.Type)
+		{
+		case EModificationType::Addition:
+			AdditiveSum += M.Value;
+			break;
+
+		case EModificationType::Subtraction:
+			AdditiveSum -= M.Value;
+			break;
+
+		case EModificationType::Multiplication:
+			MultiplicativeFactor *= M.Value;
+			break;
+
+		case EModificationType::Override:
+			OverrideValue = M.Value;
+			bHasOverride = true;
+			break;
+		}
+	}
+};
+
 USTRUCT(BlueprintType)
 struct FAttribute
 {
@@ -162,7 +194,9 @@ struct FAttribute
 	UPROPERTY(VisibleAnywhere, Category="Attribute", meta=(DisplayName="Value"))
 	float Value = 0.0f;
 	
-	UPROPERTY(VisibleAnywhere, BlueprintReadWrite, Category="Attribute", meta=(DisplayName="Active Modifiers"))
+	// Read-only outside C++: edits must go through AddModifier/RemoveModifiers/ClearModifiers so the cached
+	// aggregates stay in step (an in-place edit that keeps the count would not be noticed).
+	UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category="Attribute", meta=(DisplayName="Active Modifiers"))
 	TArray<FModifier> ActiveModifiers;
 
 	// Numeric type (Float vs Integer). If Integer, Value is rounded after recompute.
@@ -179,41 +213,61 @@ struct FAttribute
 	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category="Attribute|Clamp", meta=(EditCondition="ClampMode!=EAttributeClampMode::None", DisplayName="Clamp Value"))
 	float ClampValue = 0.0f;
 	
-	void Recalculate()
+	// Appends a modifier and folds it into the cached aggregates in O(1)
+	void AddModifier(const FModifier& Modifier)
 	{
-		Value = BaseValue;
-
-		float AdditiveSum = 0.0f;
-		float MultiplicativeFactor = 1.0f;
-		TOptional<float> OverrideValue;
+		if (Aggregates.Num() != ActiveModifiers.Num())
+		{
+			RebuildAggregates();
+		}
+		FAttributeAggregate Next = GetAggregate();
+		Next.Fold(Modifier);
+		ActiveModifiers.Add(Modifier);
+		Aggregates.Add(Next);
+	}
 
-		for (const FModifier& M : ActiveModifiers)
+	// Removes every modifier matching Pred and returns how many were removed. Only the aggregates after the first
+	// removed entry are refolded, so removing the newest modifier is O(1) and the result stays bit-identical to a
+	// full scan (subtracting a value back out of a float sum would not be).
+	template <typename PredicateType>
+	int32 RemoveModifiers(PredicateType Pred)
+	{
+		const int32 First = ActiveModifiers.IndexOfByPredicate(Pred);
+		if (First == INDEX_NONE)
 		{
-			switch (M.Type)
-			{
-			case EModificationType::Addition:
-				AdditiveSum += M.Value;
-				break;
+			return 0;
+		}
+		const int32 Removed = ActiveModifiers.RemoveAll(Pred);
+		RebuildAggregates(First);
+		return Removed;
+	}
 
-			case EModificationType::Subtraction:
-				AdditiveSum -= M.Value;
-				break;
+	void ClearModifiers()
+	{
+		ActiveModifiers.Reset();
+		Aggregates.Reset();
+	}
 
-			case EModificationType::Multiplication:
-				MultiplicativeFactor *= M.Value;
-				break;
+	// Refolds the cached aggregates from ActiveModifiers, starting at FromIndex. Call after editing ActiveModifiers
+	// directly; Recalculate only catches edits that change the count.
+	void RebuildAggregates(int32 FromIndex = 0);
 
-			case EModificationType::Override:
-				OverrideValue = M.Value;
-				break;
-			}
+	// Aggregate of all active modifiers
+	FAttributeAggregate GetAggregate() const { return Aggregates.Num() > 0 ? Aggregates.Last() : FAttributeAggregate(); }
+
+	void Recalculate()
+	{
+		if (Aggregates.Num() != ActiveModifiers.Num())
+		{
+			RebuildAggregates();
 		}
+		const FAttributeAggregate Total = GetAggregate();
 
-		Value = (Value + AdditiveSum) * MultiplicativeFactor;
+		Value = (BaseValue + Total.AdditiveSum) * Total.MultiplicativeFactor;
 
-		if (OverrideValue.IsSet())
+		if (Total.bHasOverride)
 		{
-			Value = OverrideValue.GetValue();
+			Value = Total.OverrideValue;
 		}
 
 		// If the attribute is declared as Integer, coerce using the rounding policy first
@@ -246,6 +300,10 @@ struct FAttribute
 			break;
 		}
 	}
+
+private:
+	// Aggregates[i] is the fold of ActiveModifiers[0..i]
+	TArray<FAttributeAggregate> Aggregates;
 };
 
 USTRUCT(BlueprintType)
@@ -7,6 +7,116 @@
 #include "UObject/Object.h"
 #include "ObjectPoolBase.generated.h"
 
+/**
+ * How a pool fills up. With bTimeSliced the pool spawns across frames under the subsystem's frame budget and
+ * starts growing in the background before it runs dry, instead of spawning a whole batch inside AcquireActor.
+ */
+USTRUCT(BlueprintType)
+struct FPoolGrowthPolicy
+{
+	GENERATED_BODY()
+
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category="Object Pool")
+	bool bTimeSliced = false;
+
+	// Background growth starts once the free count drops below this fraction of the pool size
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category="Object Pool", meta=(ClampMin="0.0", ClampMax="1.0", EditCondition="bTimeSliced"))
+	float LowFreeFraction = 0.25f;
+
+	// Capacity the predictor aims for, relative to the highest number of actors ever in flight at once
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category="Object Pool", meta=(ClampMin="1.0", EditCondition="bTimeSliced"))
+	float HighWatermarkHeadroom = 1.5f;
+
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category="Object Pool", meta=(ClampMin="1", EditCondition="bTimeSliced"))
+	int32 MinGrowthStep = 8;
+};
+
+/**
+ * When a pool gives memory back. Idle decay destroys a fraction of the free actors that were never needed during
+ * the last interval (the free count's low point), so a pool shrinks gradually after a spike instead of thrashing.
+ */
+USTRUCT(BlueprintType)
+struct FPoolTrimPolicy
+{
+	GENERATED_BODY()
+
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category="Object Pool")
+	bool bEnabled = false;
+
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category="Object Pool", meta=(ClampMin="0.0", EditCondition="bEnabled"))
+	float TrimIntervalSeconds = 10.f;
+
+	// Fraction of the idle surplus destroyed per interval
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category="Object Pool", meta=(ClampMin="0.0", ClampMax="1.0", EditCondition="bEnabled"))
+	float DecayFraction = 0.5f;
+
+	// Never decay below the size the pool was registered with
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category="Object Pool", meta=(EditCondition="bEnabled"))
+	bool bKeepInitialSize = true;
+
+	// Estimated footprint cap for the whole pool, 0 = unlimited. Free actors above it are trimmed regardless of decay
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category="Object Pool", meta=(ClampMin="0", EditCondition="bEnabled"))
+	int32 MemoryBudgetKB = 0;
+};
+
+/**
+ * Per-pool counters for sizing pools from real sessions. Acquire latency is a log2 histogram in microseconds:
+ * bucket 0 is < 1us, bucket i is [2^(i-1), 2^i) us, the last bucket catches everything slower.
+ */
+USTRUCT(BlueprintType)
+struct FPoolTelemetry
+{
+	GENERATED_BODY()
+
+	static constexpr int32 NumLatencyBuckets = 12;
+
+	UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category="Object Pool")
+	int32 Acquires = 0;
+
+	// Acquires served straight from the free stack
+	UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category="Object Pool")
+	int32 Hits = 0;
+
+	// Acquires that found the pool dry and had to grow synchronously
+	UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category="Object Pool")
+	int32 Misses = 0;
+
+	UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category="Object Pool")
+	int32 Releases = 0;
+
+	UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category="Object Pool")
+	int32 GrowthEvents = 0;
+
+	UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category="Object Pool")
+	int32 ActorsSpawned = 0;
+
+	// Callers that gave up on the pool and spawned their own actor (reported through the subsystem)
+	UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category="Object Pool")
+	int32 FallbackSpawns = 0;
+
+	UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category="Object Pool")
+	int32 ActorsTrimmed = 0;
+
+	UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category="Object Pool")
+	int32 PeakActive = 0;
+
+	UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category="Object Pool")
+	double TotalAcquireMicroseconds = 0.0;
+
+	UPROPERTY(VisibleAnywhere, Category="Object Pool")
+	int32 AcquireLatencyBuckets[NumLatencyBuckets] = {};
+
+	float GetHitRate() const { return Acquires > 0 ? static_cast<float>(Hits) / Acquires : 1.f; }
+	double GetAverageAcquireMicroseconds() const { return Acquires > 0 ? TotalAcquireMicroseconds / Acquires : 0.0; }
+
+	void RecordAcquireLatency(double Microseconds)
+	{
+		TotalAcquireMicroseconds += Microseconds;
+		const int32 Bucket = Microseconds < 1.0 ? 0 : FMath::FloorLog2(static_cast<uint32>(Microseconds)) + 1;
+		++AcquireLatencyBuckets[FMath::Min(Bucket, NumLatencyBuckets - 1)];
+	}
+};
+
 /**
  * 
 */
@@ -17,33 +127,94 @@ class GP4PROTOTYPE_API UObjectPoolBase : public UObject
 	
 	virtual void BeginDestroy() override;
 
+	// Pooled actors are owned by the template pool; report them here instead of mirroring them into a UPROPERTY array
+	static void AddReferencedObjects(UObject* InThis, FReferenceCollector& Collector);
+
 public:
 	UFUNCTION(BlueprintCallable)
 	void InitializePool(TSubclassOf<AActor> InClass, int32 InSize);
 
+	UFUNCTION(BlueprintCallable)
+	void InitializePoolWithPolicy(TSubclassOf<AActor> InClass, int32 InSize, const FPoolGrowthPolicy& InPolicy);
+
+	// Spawns queued actors until DeadlineSeconds (FPlatformTime::Seconds). Returns true while work remains
+	bool TickWarmUp(double DeadlineSeconds);
+
+	bool HasPendingWarmUp() const { return PendingSpawns > 0; }
+
+	UFUNCTION(BlueprintCallable)
+	void SetTrimPolicy(const FPoolTrimPolicy& InPolicy) { TrimPolicy = InPolicy; }
+
+	bool IsTrimEnabled() const { return TrimPolicy.bEnabled; }
+
+	// Advances the idle decay timer and trims when an interval completes
+	void TickTrim(float DeltaTime);
+
+	// Drops every free actor above the registered size and forgets the old high watermark. Active actors stay
+	UFUNCTION(BlueprintCallable)
+	int32 TrimForFloorTransition();
+
 	UFUNCTION(BlueprintCallable)
 	AActor* AcquireActor();
 
+	// Returns false if the actor does not belong to this pool or was already released
 	UFUNCTION(BlueprintCallable)
-	void ReleaseActor(AActor* Actor);
+	bool ReleaseActor(AActor* Actor);
+
+	// Fast path used by UPooledActorComponent, which already knows the actor's slot
+	bool ReleaseSlot(int32 Slot, AActor* Actor);
 
 	// Expose pooled class for robust pool lookup
 	UFUNCTION(BlueprintCallable)
 	TSubclassOf<AActor> GetPooledClass() const { return PooledClass; }
 
+	UFUNCTION(BlueprintCallable)
+	int32 GetNumFree() const { return PoolInstance ? PoolInstance->NumFree() : 0; }
+
+	UFUNCTION(BlueprintCallable)
+	int32 GetNumActive() const { return PoolInstance ? PoolInstance->NumActive() : 0; }
+
+	// Most actors out at once since the telemetry was last reset
+	UFUNCTION(BlueprintCallable)
+	int32 GetPeakActive() const { return Telemetry.PeakActive; }
+
+	const FPoolTelemetry& GetTelemetry() const { return Telemetry; }
+	void ResetTelemetry() { Telemetry = FPoolTelemetry(); }
+	void RecordFallbackSpawn() { ++Telemetry.FallbackSpawns; }
+
 private:
-	void SyncGCProtection();
 	void RebuildPoolForWorldChange();
+	TObjectPool<AActor>* CreatePoolInstance(int32 InSize);
+
+	// Tags a freshly spawned actor with its pool/slot back-reference
+	void OnActorSpawned(AActor* Actor, int32 Slot);
 
 	// Grow the pool by spawning AdditionalCount actors and returning them into the pool
 	bool GrowPool(int32 AdditionalCount);
+
+	// Queues background growth when free actors run low relative to the observed high watermark
+	void PredictGrowth();
+
+	int32 TrimFreeActors(int32 Count);
+
+	// Pool size the memory budget allows, MAX_int32 when there is no budget or no estimate yet
+	int32 GetMaxActorsForBudget() const;
+	static int64 EstimateActorBytes(AActor* Actor);
 	
 	TSubclassOf<AActor> PooledClass;
 	TObjectPool<AActor>* PoolInstance = nullptr;
 	int32 InitialSizeCached = 0;
-	TWeakObjectPtr<UWorld> CachedWorld; // weak to avoid dangling after world teardown
+	FPoolGrowthPolicy GrowthPolicy;
+	int32 PendingSpawns = 0;
+	// Active count the growth predictor aims for. Unlike Telemetry.PeakActive it decays with idle trims and resets on
+	// floor transitions
+	int32 ActiveWatermark = 0;
+	FPoolTelemetry Telemetry;
 
-	// This UPROPERTY array prevents the pooled actors from being garbage collected
-	UPROPERTY()
-	TArray<TObjectPtr<AActor>> GCProtectedPool;
+	FPoolTrimPolicy TrimPolicy;
+	int32 BaseSize = 0;
+	int32 MinFreeSinceLastTrim = MAX_int32;
+	float TrimTimer = 0.f;
+	int64 EstimatedBytesPerActor = 0;
+	TWeakObjectPtr<UWorld> CachedWorld; // weak to avoid dangling after world teardown
 };
\ No newline at end of file
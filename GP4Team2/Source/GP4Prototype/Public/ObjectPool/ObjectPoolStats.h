@@ -0,0 +1,17 @@
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Stats/Stats.h"
+
+// "stat ObjectPool"
+DECLARE_STATS_GROUP(TEXT("ObjectPool"), STATGROUP_ObjectPool, STATCAT_Advanced);
+
+DECLARE_CYCLE_STAT_EXTERN(TEXT("Acquire"), STAT_PoolAcquire, STATGROUP_ObjectPool, GP4PROTOTYPE_API);
+DECLARE_CYCLE_STAT_EXTERN(TEXT("Release"), STAT_PoolRelease, STATGROUP_ObjectPool, GP4PROTOTYPE_API);
+DECLARE_CYCLE_STAT_EXTERN(TEXT("Grow (sync)"), STAT_PoolGrow, STATGROUP_ObjectPool, GP4PROTOTYPE_API);
+DECLARE_CYCLE_STAT_EXTERN(TEXT("Warm Up (time-sliced)"), STAT_PoolWarmUp, STATGROUP_ObjectPool, GP4PROTOTYPE_API);
+
+DECLARE_DWORD_COUNTER_STAT_EXTERN(TEXT("Acquires"), STAT_PoolAcquireCount, STATGROUP_ObjectPool, GP4PROTOTYPE_API);
+DECLARE_DWORD_COUNTER_STAT_EXTERN(TEXT("Acquire Misses"), STAT_PoolMissCount, STATGROUP_ObjectPool, GP4PROTOTYPE_API);
+DECLARE_DWORD_COUNTER_STAT_EXTERN(TEXT("Fallback Spawns"), STAT_PoolFallbackSpawnCount, STATGROUP_ObjectPool, GP4PROTOTYPE_API);
+DECLARE_DWORD_ACCUMULATOR_STAT_EXTERN(TEXT("Active Pooled Actors"), STAT_PoolActiveActors, STATGROUP_ObjectPool, GP4PROTOTYPE_API);
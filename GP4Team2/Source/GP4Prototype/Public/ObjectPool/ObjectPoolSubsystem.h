@@ -4,29 +4,71 @@
 
 #include "CoreMinimal.h"
 #include "ObjectPoolBase.h"
+#include "PoolHandle.h"
 #include "Subsystems/GameInstanceSubsystem.h"
+#include "Tickable.h"
 #include "ObjectPoolSubsystem.generated.h"
 
 /**
  * 
 */
 UCLASS()
-class GP4PROTOTYPE_API UObjectPoolSubsystem : public UGameInstanceSubsystem
+class GP4PROTOTYPE_API UObjectPoolSubsystem : public UGameInstanceSubsystem, public FTickableGameObject
 {
 	GENERATED_BODY()
 
 public:
-	/** Registers (or gets existing) pool for the given class */
+	// FTickableGameObject: drives time-sliced warm-up/growth and idle trimming of registered pools
+	virtual void Tick(float DeltaTime) override;
+	virtual bool IsTickable() const override;
+	virtual ETickableTickType GetTickableTickType() const override { return IsTemplate() ? ETickableTickType::Never : ETickableTickType::Conditional; }
+	virtual TStatId GetStatId() const override { RETURN_QUICK_DECLARE_CYCLE_STAT(UObjectPoolSubsystem, STATGROUP_Tickables); }
+
+	/** Registers (or gets existing) pool for the given class. Keep the handle for the per-call fast path */
+	UFUNCTION(BlueprintCallable, Category = "Object Pool")
+	FPoolHandle RegisterPool(TSubclassOf<AActor> ActorClass, int32 InitialSize = 10);
+
+	/** Same as RegisterPool, but a new pool is created with the given growth policy (e.g. time-sliced warm-up) */
+	UFUNCTION(BlueprintCallable, Category = "Object Pool")
+	FPoolHandle RegisterPoolWithPolicy(TSubclassOf<AActor> ActorClass, int32 InitialSize, const FPoolGrowthPolicy& Policy);
+
+	/** Get (and activate) an actor from a registered pool. Direct index, no lookup */
 	UFUNCTION(BlueprintCallable, Category = "Object Pool")
-	void RegisterPool(TSubclassOf<AActor> ActorClass, int32 InitialSize = 10);
+	AActor* AcquireActorByHandle(FPoolHandle Handle);
 
-	/** Get (and activate) an actor from the appropriate pool */
+	/** Get (and activate) an actor from the appropriate pool, registering one on first use */
 	UFUNCTION(BlueprintCallable, Category = "Object Pool")
 	AActor* AcquireActor(TSubclassOf<AActor> ActorClass);
 
-	/** Return an actor back to its pool */
+	/** Return an actor back to its pool. Returns false if the actor was not pooled */
 	UFUNCTION(BlueprintCallable, Category = "Object Pool")
-	void ReleaseActor(AActor* Actor);
+	bool ReleaseActor(AActor* Actor);
+
+	UFUNCTION(BlueprintCallable, Category = "Object Pool")
+	void SetTrimPolicy(FPoolHandle Handle, const FPoolTrimPolicy& Policy);
+
+	/** Shrinks every pool back to its registered size. Call when a floor ends */
+	UFUNCTION(BlueprintCallable, Category = "Object Pool")
+	int32 TrimPoolsForFloorTransition();
+
+	/** Callers that could not get an actor from the pool and spawned their own report it here for telemetry */
+	UFUNCTION(BlueprintCallable, Category = "Object Pool")
+	void RecordFallbackSpawn(FPoolHandle Handle);
+
+	UFUNCTION(BlueprintCallable, Category = "Object Pool|Telemetry")
+	FPoolTelemetry GetPoolTelemetry(FPoolHandle Handle) const;
+
+	UFUNCTION(BlueprintCallable, Category = "Object Pool|Telemetry")
+	void ResetTelemetry();
+
+	/** One row per pool: counters, hit rate, latency stats and histogram buckets */
+	FString BuildTelemetryCsv() const;
+
+	/** Writes BuildTelemetryCsv to Saved/Profiling. Also available as the console command GP4.Pool.DumpTelemetry */
+	UFUNCTION(BlueprintCallable, Category = "Object Pool|Telemetry")
+	bool DumpTelemetryCsv();
+
+	UObjectPoolBase* GetPool(FPoolHandle Handle) const { return PoolList.IsValidIndex(Handle.Index) ? PoolList[Handle.Index].Get() : nullptr; }
 
 	// Debug options
 	UPROPERTY(EditAnywhere, Category = "Debug")
@@ -35,10 +77,19 @@ public:
 	UPROPERTY(EditAnywhere, Category = "Debug", meta=(ClampMin="0.0"))
 	float DebugDuration = 5.0f;
 
+	// Game thread time per frame that time-sliced pools may spend spawning, shared across all pools
+	UPROPERTY(EditAnywhere, Category = "Warm Up", meta=(ClampMin="0.0"))
+	float WarmUpBudgetMs = 1.0f;
+
 private:
-	/** Mapping between Actor class and its pool instance */
+	/** Pools in registration order; FPoolHandle::Index points in here */
+	UPROPERTY()
+	TArray<TObjectPtr<UObjectPoolBase>> PoolList;
+
+	/** Mapping between Actor class and its pool handle, used on registration, class based acquire and releasing actors
+	 *  that do not cache their back-reference */
 	UPROPERTY()
-	TMap<TSubclassOf<AActor>, TObjectPtr<UObjectPoolBase>> Pools;
+	TMap<TSubclassOf<AActor>, FPoolHandle> HandlesByClass;
 
-	UObjectPoolBase* GetOrCreatePool(TSubclassOf<AActor> ActorClass, int32 DefaultSize = 10);
-};
\ No newline at end of file
+	FPoolHandle GetOrCreatePool(TSubclassOf<AActor> ActorClass, int32 DefaultSize = 10, const FPoolGrowthPolicy& Policy = FPoolGrowthPolicy());
+};
@@ -1,25 +1,97 @@
 ﻿#pragma once
 
 #include "CoreMinimal.h"
+#include "UObject/ObjectKey.h"
+#include "UObject/UObjectGlobals.h"
+#include "ObjectPool/Poolable.h"
 
+/**
+ * Slot based object pool. Every pooled object lives in a fixed slot of Items; free and active slots are
+ * tracked in two index stacks so Acquire/Release are O(1). Items are strong references, reported to GC
+ * by the owning UObject through AddReferencedObjects. Classes implementing IPoolable get OnAcquired/OnReleased.
+ *
+ * Actor pools spawn through the world and toggle state with PooledActorState. Any other UObject (widgets,
+ * audio/VFX components) uses the factory constructor: the factory creates objects, the reset functor
+ * puts them in and out of service.
+ */
 template <typename T>
 class TObjectPool
 {
 public:
-	TObjectPool(UWorld* InWorld, TSubclassOf<T> InClass, int32 InInitialSize, UObject* Owner);
+	// Called once per spawned object with the slot it was given, before it enters the free stack
+	using FOnSpawned = TFunction<void(T* /*Obj*/, int32 /*Slot*/)>;
+
+	// Creates a new object for the pool. Returning nullptr stops the current Grow
+	using FFactory = TFunction<T*()>;
+
+	// Moves an object in (bActive = true) or out of service. Runs before OnAcquired / after OnReleased
+	using FResetFn = TFunction<void(T* /*Obj*/, bool /*bActive*/)>;
+
+	// Actor pool
+	TObjectPool(UWorld* InWorld, TSubclassOf<T> InClass, int32 InInitialSize, UObject* Owner, FOnSpawned InOnSpawned = nullptr);
+
+	// Generic UObject pool
+	TObjectPool(FFactory InFactory, FResetFn InReset, int32 InInitialSize, FOnSpawned InOnSpawned = nullptr);
+
+	// Pops a free slot and activates it. Returns nullptr when the pool is dry (caller decides whether to grow)
 	T* Acquire();
-	void Release(T* Obj);
 
-	TArray<TWeakObjectPtr<T>>& GetPool() { return Pool; }
+	// Pushes the object back onto the free stack. Returns false if the object does not belong to this pool or is already free
+	bool Release(T* Obj);
+
+	// Release when the caller already knows the slot (pooled actor back-reference). Returns false on slot/object mismatch
+	bool ReleaseSlot(int32 Slot, T* Obj);
+
+	// Spawns AdditionalCount new inactive objects straight into the free stack. Returns how many were spawned
+	int32 Grow(int32 AdditionalCount);
+
+	// Destroys up to Count free objects (actors are destroyed, components unregistered, others left to GC). Active objects are never touched. Returns how many were destroyed
+	int32 TrimFree(int32 Count);
+
+	bool Contains(const T* Obj) const { return SlotLookup.Contains(TObjectKey<T>(Obj)); }
+	int32 NumFree() const { return FreeSlots.Num(); }
+	int32 NumActive() const { return ActiveSlots.Num(); }
+	int32 Num() const { return SlotLookup.Num(); }
+
+	void AddReferencedObjects(FReferenceCollector& Collector, const UObject* ReferencingObject);
 
 	void RefreshWorld(UWorld* InWorld) { if (InWorld && InWorld != WorldPtr.Get()) { WorldPtr = InWorld; } }
 
 private:
 	T* SpawnNew();
+	int32 AddToSlot(T* Obj);
+	void DiscardSlot(int32 Slot);
+	void CullDestroyedActive();
+
+	void Activate(T* Obj) const;
+	void Deactivate(T* Obj) const;
+
 	// Stored as weak to avoid dangling after world teardown
 	TWeakObjectPtr<UWorld> WorldPtr;
 	TSubclassOf<T> ClassToSpawn;
-	TArray<TWeakObjectPtr<T>> Pool;
+	FOnSpawned OnSpawned;
+	FFactory Factory;
+	FResetFn ResetFn;
+
+	// Resolved once per pool from the first object; every object is expected to share the class
+	bool bPoolable = false;
+	bool bPoolableResolved = false;
+
+	// Slot -> object. Null entries are dead slots waiting in DeadSlots to be reused
+	TArray<TObjectPtr<T>> Items;
+
+	// Slot -> lookup key, kept so a slot whose object was already collected can still be unmapped
+	TArray<TObjectKey<T>> ItemKeys;
+
+	// Slot -> index into ActiveSlots, INDEX_NONE while the slot is free or dead
+	TArray<int32> ActivePosition;
+
+	TArray<int32> FreeSlots;
+	TArray<int32> ActiveSlots;
+	TArray<int32> DeadSlots;
+
+	// Object -> slot, so Release never has to scan
+	TMap<TObjectKey<T>, int32> SlotLookup;
 };
 
 #include "ObjectPool/ObjectPoolTemplate.inl"
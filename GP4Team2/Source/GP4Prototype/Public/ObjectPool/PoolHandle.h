@@ -0,0 +1,25 @@
+#pragma once
+
+#include "CoreMinimal.h"
+#include "PoolHandle.generated.h"
+
+/**
+ * Index of a pool registered in UObjectPoolSubsystem. Pools are never unregistered, so the index stays valid
+ * for the lifetime of the subsystem.
+ */
+USTRUCT(BlueprintType)
+struct FPoolHandle
+{
+	GENERATED_BODY()
+
+	UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category="Object Pool")
+	int32 Index = INDEX_NONE;
+
+	bool IsValid() const { return Index != INDEX_NONE; }
+
+	friend bool operator==(const FPoolHandle& A, const FPoolHandle& B) { return A.Index == B.Index; }
+	friend bool operator!=(const FPoolHandle& A, const FPoolHandle& B) { return A.Index != B.Index; }
+
+	FPoolHandle() = default;
+	explicit FPoolHandle(int32 InIndex) : Index(InIndex) {}
+};
@@ -0,0 +1,50 @@
+#pragma once
+
+#include "CoreMinimal.h"
+#include "UObject/Interface.h"
+#include "Poolable.generated.h"
+
+class UPooledActorComponent;
+
+UINTERFACE(Blueprintable)
+class UPoolable : public UInterface
+{
+	GENERATED_BODY()
+};
+
+/**
+ * Optional hooks for pooled classes. The pool already puts actors to sleep (tick, collision, physics, rendering)
+ * through PooledActorState; these are for class specific state that has to be reset between uses.
+ */
+class GP4PROTOTYPE_API IPoolable
+{
+	GENERATED_BODY()
+
+public:
+	// Called after the object is taken from the pool and woken up, before it is handed to the caller
+	UFUNCTION(BlueprintCallable, BlueprintNativeEvent, Category="Object Pool")
+	void OnAcquired();
+
+	// Called when the object goes back to the pool, before it is put to sleep
+	UFUNCTION(BlueprintCallable, BlueprintNativeEvent, Category="Object Pool")
+	void OnReleased();
+
+	// Native pooled actors can keep the back-reference the pool adds when it spawns them, so releasing never has to
+	// search the actor's components for it
+	virtual void SetPooledComponent(UPooledActorComponent* InPooledComponent) {}
+	virtual UPooledActorComponent* GetPooledComponent() const { return nullptr; }
+
+protected:
+	virtual void OnAcquired_Implementation() {}
+	virtual void OnReleased_Implementation() {}
+};
+
+namespace PooledActorState
+{
+	/**
+	 * Wakes up or puts to sleep everything on the actor in one pass over its components: actor and component tick,
+	 * collision, simulated physics, movement and visibility. Waking restores the class defaults rather than whatever
+	 * state the actor had, so reuse is deterministic.
+	 */
+	GP4PROTOTYPE_API void SetActive(AActor* Actor, bool bActive);
+}
@@ -0,0 +1,36 @@
+﻿// Fill out your copyright notice in the Description page of Project Settings.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Components/ActorComponent.h"
+#include "PooledActorComponent.generated.h"
+
+class UObjectPoolBase;
+
+/**
+ * Back-reference from a pooled actor to the pool and slot it lives in. Added by UObjectPoolBase when the actor
+ * is spawned, so returning it to the pool never needs a class lookup.
+ */
+UCLASS(ClassGroup=(Custom))
+class GP4PROTOTYPE_API UPooledActorComponent : public UActorComponent
+{
+	GENERATED_BODY()
+
+public:
+	UPooledActorComponent();
+
+	void Bind(UObjectPoolBase* InPool, int32 InSlot);
+
+	// Returns false if the owning pool is gone (world change) so the caller can fall back to Destroy, or if the
+	// actor is already back in the pool
+	UFUNCTION(BlueprintCallable, Category="Object Pool")
+	bool ReleaseToPool();
+
+	UObjectPoolBase* GetOwningPool() const { return OwningPool.Get(); }
+	int32 GetSlot() const { return Slot; }
+
+private:
+	TWeakObjectPtr<UObjectPoolBase> OwningPool;
+	int32 Slot = INDEX_NONE;
+};
@@ -8,6 +8,7 @@
 #include "AISpawnBrain.generated.h"
 
 class AAISpawnTrigger;
+class UEnemyBroadphaseSubsystem;
 
 UCLASS()
 class GP4PROTOTYPE_API AAISpawnBrain : public AActor
@@ -44,6 +45,9 @@ public:
 
 	UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category="Spawner")
 	TArray<AAISpawnTrigger*> Triggers;
+
+	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category="Spawner|Broadphase", meta = (ClampMin = "50", ToolTip = "Cell size of the enemy grid combat uses to skip sweeps when nobody is near. Roughly the longest melee/dash reach."))
+	float EnemyGridCellSize = 500.0f;
 	
 protected:
 	// Called when the game starts or when spawned
@@ -65,9 +69,17 @@ public:
 	UFUNCTION(BlueprintCallable, Category="Spawner")
 	void CalculateTotalAI();
 
+	// Adds to ActiveEnemies and the combat broadphase grid
+	UFUNCTION(BlueprintCallable, Category="Spawner")
+	void RegisterActiveEnemy(AAICharacterBase* Enemy);
+
 	UFUNCTION(BlueprintCallable, Category="Final Aggro")
 	void HandleAIDeath(AAICharacterBase* DeadAI);
 
 	UFUNCTION(BlueprintCallable, Category="Difficulty")
 	void ApplyDifficultySpawnIncrease(int FloorNumber);
+
+private:
+	UPROPERTY()
+	TObjectPtr<UEnemyBroadphaseSubsystem> EnemyBroadphase;
 };
@@ -42,6 +42,28 @@ public:
 	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category="Spawn|Single")
 	FVector SpawnSearchRadius = FVector(1000.0f, 1000.0f, 1000.f);
 
+	/** Grid spacing of the navmesh samples that make up the spawn location pool */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category="Spawn|Pool", meta=(ClampMin="10"))
+	float SpawnPoolGridStep = 100.f;
+
+	/** Height of each sampling layer across SpawnSearchRadius.Z; keep it below the floor-to-floor height so every floor in the box is found */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category="Spawn|Pool", meta=(ClampMin="10"))
+	float SpawnPoolLayerHeight = 200.f;
+
+	/** Re-sample the pool when play starts, for levels whose navmesh changed after the spawner was last moved */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category="Spawn|Pool")
+	bool bRebuildSpawnPoolOnBeginPlay = false;
+
+	/** Seconds between runtime re-samples while the pool is empty (navmesh still generating), so failed spawns do not
+	 *  re-run the whole grid every time */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category="Spawn|Pool", meta=(ClampMin="0"))
+	float SpawnPoolRetryInterval = 2.f;
+
+	/** Navmesh-projected, ground-snapped spawn locations relative to this actor, sampled in the editor (or at BeginPlay
+	 *  when empty). Relative so the pool stays valid when the level is instanced or streamed in with an offset */
+	UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category="Spawn|Pool")
+	TArray<FVector> RelativeSpawnLocationPool;
+
 	UPROPERTY(BlueprintAssignable, Category="Spawn|Events")
 	FOnSpawnFinished OnSpawnFinished;
 
@@ -52,6 +74,22 @@ protected:
 
 	virtual void OnConstruction(const FTransform& Transform) override;
 
+	int32 NextSpawnPoolIndex = 0;
+
+	// World time before which an empty pool is not re-sampled
+	float NextSpawnPoolRetryTime = 0.f;
+
+	int32 SpawnPoolBuildCount = 0;
+
+	// Inputs the pool was last sampled with; serialized so loading the level does not re-sample unchanged spawners
+	UPROPERTY()
+	uint32 SpawnPoolBuildKey = 0;
+
+	uint32 ComputeSpawnPoolBuildKey() const;
+
+	// Actor frame the pool is stored in; scale is left out so the pool keeps world distances
+	FTransform GetSpawnPoolFrame() const { return FTransform(GetActorQuat(), GetActorLocation()); }
+
 
 public:
 	// Called every frame
@@ -60,6 +98,17 @@ public:
 	UFUNCTION(CallInEditor)
 	TArray<FName> GetAvailablePatrolRoutes() const;
 
+	/** Samples the search box on a SpawnPoolGridStep grid in SpawnPoolLayerHeight layers, projects each sample onto the
+	 *  navmesh and snaps it to the ground */
+	UFUNCTION(CallInEditor, BlueprintCallable, Category="Spawn|Pool")
+	void BuildSpawnLocationPool();
+
+	/** Next world location from the pool, walked in shuffled order so consecutive spawns spread out; false when the pool is empty */
+	UFUNCTION(BlueprintCallable, Category="Spawn|Pool")
+	bool DrawSpawnLocation(FVector& OutLocation);
+
+	int32 GetSpawnPoolBuildCount() const { return SpawnPoolBuildCount; }
+
 	UFUNCTION(BlueprintCallable, Category="Spawn")
 	virtual void StartSpawn();
 	
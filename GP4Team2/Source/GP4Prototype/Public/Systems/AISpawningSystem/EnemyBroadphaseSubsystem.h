@@ -0,0 +1,94 @@
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Subsystems/WorldSubsystem.h"
+#include "EnemyBroadphaseSubsystem.generated.h"
+
+class AAICharacterBase;
+
+using FEnemyCandidateList = TArray<AAICharacterBase*, TInlineAllocator<16>>;
+
+/**
+ * Uniform XY grid over live enemies, used as a broadphase in front of combat sweeps. Spawn brains own the enemies:
+ * they add them as they spawn, remove them on death and refresh positions once per tick, so a query only looks at
+ * the few cells around the swing instead of the whole scene. Every other IDamageable actor in the world (destructible
+ * props and the like) is filed into the same grid when it is activated or spawns, so gated sweeps still reach them.
+ * Queries are conservative (each actor is treated as a sphere around its bounds); a hit still needs the real sweep.
+ * Toggle with GP4.Combat.EnemyBroadphase.
+ */
+UCLASS()
+class GP4PROTOTYPE_API UEnemyBroadphaseSubsystem : public UWorldSubsystem
+{
+	GENERATED_BODY()
+
+public:
+	virtual void Deinitialize() override;
+
+	// False when GP4.Combat.EnemyBroadphase is 0; combat states then always sweep
+	static bool IsBroadphaseEnabled();
+
+	// Called by a spawn brain at BeginPlay. Until then the grid knows nothing, so MayOverlapTargets never rules anything out.
+	// Also collects the world's non-enemy damageables and starts watching for new ones
+	void ActivateGrid(float InCellSize);
+	bool IsGridActive() const { return bGridActive; }
+
+	void AddEnemy(AAICharacterBase* Enemy);
+	void RemoveEnemy(AAICharacterBase* Enemy);
+
+	// Non-enemy IDamageable actors; picked up automatically once the grid is active
+	void AddDamageable(AActor* Actor);
+	void RemoveDamageable(AActor* Actor);
+
+	// Refreshes positions of the given enemies, moving those that changed cell; invalid ones are dropped
+	void UpdateEnemies(const TArray<AAICharacterBase*>& Enemies);
+
+	// Same for the tracked non-enemy damageables, which can be knocked around or destroyed
+	void UpdateDamageables();
+
+	// Enemies that may touch a sphere of Radius swept from Start to End (Start == End for a plain sphere)
+	int32 QuerySweptSphere(const FVector& Start, const FVector& End, float Radius, FEnemyCandidateList& OutEnemies) const;
+
+	// Gate for narrowphase sweeps: false only when the grid proves no enemy or other damageable besides IgnoreActor
+	// can be touched
+	bool MayOverlapTargets(const FVector& Start, const FVector& End, float Radius, const AActor* IgnoreActor = nullptr) const;
+
+	int32 GetNumEnemies() const { return EntryIndices.Num() - DamageableIndices.Num(); }
+	int32 GetNumDamageables() const { return DamageableIndices.Num(); }
+
+private:
+	struct FGridEntry
+	{
+		TWeakObjectPtr<AActor> Actor;
+		TObjectKey<AActor> Key;
+		FVector Location = FVector::ZeroVector;
+		float Extent = 0.f;
+		FIntPoint Cell = FIntPoint::ZeroValue;
+		bool bEnemy = true;
+	};
+
+	FIntPoint GetCell(const FVector& Location) const;
+	int32 AddEntry(AActor* Actor, bool bEnemy);
+	void RefreshEntry(int32 Index, const AActor* Actor);
+	void RemoveAt(int32 Index);
+	void OnActorSpawned(AActor* Actor);
+	static bool IsNonEnemyDamageable(const AActor* Actor);
+	void RebuildCells();
+
+	template <typename FunctorType>
+	void ForEachCandidate(const FVector& Start, const FVector& End, float Radius, FunctorType&& Functor) const;
+
+	bool bGridActive = false;
+	FDelegateHandle ActorSpawnedHandle;
+	float CellSize = 500.f;
+
+	// Largest enemy extent seen; queries widen by it since an enemy is filed under the cell of its center only
+	float MaxExtent = 0.f;
+
+	// Stable indices, so cells can store them directly
+	TSparseArray<FGridEntry> Entries;
+	TMap<TObjectKey<AActor>, int32> EntryIndices;
+
+	// Subset of Entries that are not enemies, walked by UpdateDamageables
+	TSet<int32> DamageableIndices;
+	TMap<FIntPoint, TArray<int32, TInlineAllocator<4>>> Cells;
+};
@@ -7,6 +7,8 @@
 #include "DataStructures/AttributeUpgradeDataStructs.h"
 #include "AgentData.generated.h"
 
+struct FAttributeTemplate;
+
 USTRUCT(BlueprintType, Category="Attribute", meta=(DisplayName="Agent Attribute"))
 struct FAgentAttribute
 {
@@ -34,6 +36,39 @@ struct FAgentAttribute
 	float ClampValue = 0.f;
 };
 
+// Cooked form of one FAgentAttribute: validated, integer-rounded and pre-recalculated by UAgentData::BakeAttributes
+USTRUCT()
+struct FAgentAttributeBaked
+{
+	GENERATED_BODY()
+
+	UPROPERTY()
+	FGameplayTag AttributeTag;
+
+	// Dense EAttributeId index, or INDEX_NONE for tags outside the native table
+	UPROPERTY()
+	int32 NativeIndex = INDEX_NONE;
+
+	UPROPERTY()
+	float BaseValue = 0.f;
+
+	// Value with rounding and clamp already applied
+	UPROPERTY()
+	float Value = 0.f;
+
+	UPROPERTY()
+	float ClampValue = 0.f;
+
+	UPROPERTY()
+	EAttributeNumericType NumericType = EAttributeNumericType::Float;
+
+	UPROPERTY()
+	EAttributeRoundingMode RoundingMode = EAttributeRoundingMode::None;
+
+	UPROPERTY()
+	EAttributeClampMode ClampMode = EAttributeClampMode::None;
+};
+
 /**
  * 
  */
@@ -45,4 +80,31 @@ class GP4PROTOTYPE_API UAgentData : public UDataAsset
 public:
 	UPROPERTY(EditDefaultsOnly, BlueprintReadOnly, Category="Attribute")
 	TArray<FAgentAttribute> Attributes;
+
+	// Immutable attribute set built from the baked entries, shared by every component initialized from this asset
+	TSharedRef<const FAttributeTemplate> GetAttributeTemplate() const;
+
+	// Validates Attributes and flattens them into BakedAttributes: tags resolved to dense indices, duplicates and
+	// invalid tags dropped, integers rounded and values recalculated. Runs on save and cook.
+	void BakeAttributes();
+
+	virtual void PostLoad() override;
+
+#if WITH_EDITOR
+	virtual void PreSave(FObjectPreSaveContext SaveContext) override;
+	virtual void PostEditChangeProperty(FPropertyChangedEvent& PropertyChangedEvent) override;
+#endif
+
+private:
+	// True when BakedAttributes were produced against the current native tag table
+	bool AreBakedAttributesValid() const;
+
+	// Saved with the asset so loading only has to lay the entries out
+	UPROPERTY()
+	TArray<FAgentAttributeBaked> BakedAttributes;
+
+	UPROPERTY()
+	bool bAttributesBaked = false;
+
+	mutable TSharedPtr<const FAttributeTemplate> AttributeTemplate;
 };
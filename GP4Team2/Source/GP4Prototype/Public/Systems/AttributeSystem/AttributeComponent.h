@@ -5,6 +5,7 @@
 #include "AgentData.h"
 #include "GameplayTagContainer.h"
 #include "DataStructures/AttributeUpgradeDataStructs.h"
+#include "Systems/AttributeSystem/AttributeStore.h"
 #include "TimerManager.h"
 #include "AttributeComponent.generated.h"
 
@@ -40,56 +41,9 @@ public:
 
 	DECLARE_DYNAMIC_MULTICAST_DELEGATE(FOnAttributeInitializedSignature);
 
-	UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category="Attribute|Data")
-	TMap<FGameplayTag, FAttribute> Attributes;
-
 	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category="Attribute|Data")
 	UAgentData* AgentData;
 
-	// -- Attributes --
-#pragma region Attributes
-	FAttribute& MaxHealth = RegisterAndGetAttribute("Attribute.MaxHealth", "Base MaxHealth attribute");
-	FAttribute& MaxDefense = RegisterAndGetAttribute("Attribute.MaxDefense", "Base MaxDefense attribute");
-	
-	FAttribute& DashCooldown = RegisterAndGetAttribute("Attribute.Dash.Cooldown", "Cooldown of the dash in seconds");
-	FAttribute& DashCooldownPerCharge = RegisterAndGetAttribute("Attribute.Dash.CooldownPerCharge", "Cooldown of the dash per charge in seconds");
-	FAttribute& DashKnockbackForce = RegisterAndGetAttribute("Attribute.Dash.KnockbackForce", "Force applied to the target on dash collision");
-	FAttribute& DashKnockbackForceDead = RegisterAndGetAttribute("Attribute.Dash.KnockbackForceDead", "Force applied to the dead target on dash collision");
-	FAttribute& DashStrength = RegisterAndGetAttribute("Attribute.Dash.Strength", "Strength of the dash impulse");
-	FAttribute& DashMaxCharges = RegisterAndGetAttribute("Attribute.Dash.MaxCharges", "Maximum number of dash charges");
-	FAttribute& DashCollisionDamage = RegisterAndGetAttribute("Attribute.Dash.CollisionDamage", "Damage dealt when colliding with an enemy during a dash");
-
-	FAttribute& KillstreakExplosiveRounds = RegisterAndGetAttribute("Attribute.Killstreak.ExplosiveRounds", "Number of explosive rounds granted on killstreak");
-
-	FAttribute& WalkSpeed = RegisterAndGetAttribute("Attribute.Movement.WalkSpeed", "Walking speed");
-	FAttribute& SprintSpeed = RegisterAndGetAttribute("Attribute.Movement.SprintSpeed", "Sprinting speed");
-	FAttribute& CrouchSpeed = RegisterAndGetAttribute("Attribute.Movement.CrouchSpeed", "Crouching speed");
-
-	FAttribute& MeleeDamage = RegisterAndGetAttribute("Attribute.Melee.Damage", "Damage dealt by melee attacks");
-	FAttribute& MeleeKnockbackForce = RegisterAndGetAttribute("Attribute.Melee.KnockbackForce", "Force applied to the target on hit");
-	FAttribute& MeleeKnockbackForceDead = RegisterAndGetAttribute("Attribute.Melee.KnockbackForceDead", "Force applied to the dead target on hit");
-	FAttribute& MeleeCooldown = RegisterAndGetAttribute("Attribute.Melee.Cooldown", "Cooldown between melee attacks");
-	FAttribute& MeleeHitDetection = RegisterAndGetAttribute("Attribute.Melee.HitDetection", "Amount of enemies that can be hit per melee attack");
-	FAttribute& MeleeHitDetectionRadius = RegisterAndGetAttribute("Attribute.Melee.HitDetectionRadius", "Radius of the melee hit detection sphere");
-	FAttribute& MeleeSwingAmount = RegisterAndGetAttribute("Attribute.Melee.SwingAmount", "Degrees to swing the melee weapon");
-
-	FAttribute& SlideStrength = RegisterAndGetAttribute("Attribute.Slide.Strength", "Strength of the slide impulse");
-	FAttribute& SlideDuration = RegisterAndGetAttribute("Attribute.Slide.Duration", "Duration of the slide in seconds");
-	FAttribute& SlideCooldown = RegisterAndGetAttribute("Attribute.Slide.Cooldown", "Cooldown of the slide in seconds");
-	FAttribute& SlideCollisionDamage = RegisterAndGetAttribute("Attribute.Slide.CollisionDamage", "Damage dealt when colliding with an enemy during a slide");
-
-	FAttribute& SlowMoTimeDilation = RegisterAndGetAttribute("Attribute.SlowMo.TimeDilation", "Global time dilation factor when slow-mo is active (e.g., 0.2..0.5)");
-	FAttribute& SlowMoMaxDuration = RegisterAndGetAttribute("Attribute.SlowMo.MaxDuration", "Maximum duration of slow-mo when triggered (seconds)");
-	FAttribute& SlowMoCooldown = RegisterAndGetAttribute("Attribute.SlowMo.Cooldown", "Cooldown between slow-mo activations (seconds)");
-
-	FAttribute& ThrowForce = RegisterAndGetAttribute("Attribute.Throw.Force", "Force applied to thrown objects");
-	FAttribute& ThrowDamage = RegisterAndGetAttribute("Attribute.Throw.Damage", "Damage dealt by thrown objects");
-
-	FAttribute& FireDelay = RegisterAndGetAttribute("Attribute.Weapon.FireDelay", "Delay between shots");
-	FAttribute& ReloadSpeed = RegisterAndGetAttribute("Attribute.Weapon.ReloadSpeed", "Speed of reloading");
-	FAttribute& WeaponDamage = RegisterAndGetAttribute("Attribute.Weapon.Damage", "Base weapon damage");
-#pragma endregion
-
 	// -- Attribute|Get --
 #pragma region Get
 	UFUNCTION(BlueprintPure, Category="Attribute|Get")
@@ -98,6 +52,11 @@ public:
 	UFUNCTION(BlueprintPure, Category="Attribute|Get")
 	FGameplayTag GetAttributeTag(FAttribute attribute);
 
+	// Every registered attribute by tag, built on call. Replaces reading the old Attributes map property; per-frame code
+	// should read single attributes instead
+	UFUNCTION(BlueprintPure, Category="Attribute|Get")
+	TMap<FGameplayTag, FAttribute> GetAttributes() const;
+
 	UFUNCTION(BlueprintPure, Category="Attribute|Get")
 	float GetAttributeBaseValue(FGameplayTag tag) const;
 
@@ -111,6 +70,11 @@ public:
 	UFUNCTION(BlueprintPure, Category="Attribute|Get")
 	float GetAttributeClamped(FGameplayTag Tag, float Min, float Max) const;
 
+	// Indexed reads of native attributes: a single array load, no tag hashing. Prefer these on per-frame paths.
+	float GetAttributeValue(EAttributeId Id) const { return Attributes.GetValue(Id); }
+	float GetAttributeBaseValue(EAttributeId Id) const { return Attributes.GetBaseValue(Id); }
+	int32 GetAttributeValueInt(EAttributeId Id) const { return FMath::RoundToInt(GetAttributeValue(Id)); }
+
 	UFUNCTION(BlueprintPure, Category="Attribute|Get")
 	bool HasAttribute(FGameplayTag Tag) const;
 
@@ -209,16 +173,39 @@ public:
 	void RecalculateAll();
 #pragma endregion
 
+	// -- Attribute|Batch --
+#pragma region Batch
+	// Defers recalculation and value-change events until the matching EndBatch. Each touched attribute is then
+	// recalculated once and fires one OnAttributeValueChanged/OnAnyAttributeChanged from its pre-batch value.
+	// Batches nest. Inside a batch, values of touched attributes read as their pre-batch values.
+	UFUNCTION(BlueprintCallable, Category="Attribute|Batch")
+	void BeginBatch();
+
+	UFUNCTION(BlueprintCallable, Category="Attribute|Batch")
+	void EndBatch();
+
+	UFUNCTION(BlueprintPure, Category="Attribute|Batch")
+	bool IsBatching() const { return BatchDepth > 0; }
+
+	// Value-change delegate invocations avoided by coalescing, since the component was created
+	UFUNCTION(BlueprintPure, Category="Attribute|Batch")
+	int32 GetBroadcastsSaved() const { return BroadcastsSaved; }
+#pragma endregion
+
 	// -- Attribute|Load --
 #pragma region Load
 	UFUNCTION(BlueprintCallable, Category="Attribute|Load")
 	void InitializeFromAgentData(UAgentData* newAgentData);
 
+	// Registers the tag and returns a snapshot of its record; edit it through the setters so cached values stay in sync
 	UFUNCTION(BlueprintCallable, Category="Attribute|Load")
-	FAttribute& RegisterAndGetAttribute(const FString& TagName, const FString& DevComment);
+	FAttribute RegisterAndGetAttribute(const FString& TagName, const FString& DevComment);
 
 	UFUNCTION(BlueprintPure, Category="Attribute|State")
 	bool IsInitialized() const { return bAttributesInitialized; }
+
+	// Storage view for diagnostics and tests
+	const FAttributeStore& GetAttributeStore() const { return Attributes; }
 	
 #pragma endregion
 
@@ -256,9 +243,23 @@ public:
 	// Debug
 	UFUNCTION(BlueprintCallable, Category="Attribute|Debug")
 	void DumpAttributes() const;
+
+#if WITH_EDITORONLY_DATA
+	// Copy of the attributes for the details panel; storage is no longer a reflected map, so refresh it on demand
+	UPROPERTY(VisibleInstanceOnly, Transient, Category="Attribute|Debug")
+	TMap<FGameplayTag, FAttribute> AttributeSnapshot;
+#endif
+
+#if WITH_EDITOR
+	UFUNCTION(CallInEditor, Category="Attribute|Debug")
+	void RefreshAttributeSnapshot();
+#endif
 #pragma endregion
 
 private:
+	// Dense storage: native attributes at their EAttributeId index, runtime-registered tags appended
+	FAttributeStore Attributes;
+
 	TMap<TWeakObjectPtr<UObject>, TArray<FAppliedModifierRef>> SourceAppliedModifiers;
 
 	TMap<FGuid, FGameplayTag> TempIdToTag;
@@ -268,4 +269,19 @@ private:
 	void EnsureAttributesInitialized();
 
 	void HandleTempModifierExpired(FGuid ModifierID);
+
+	// Recalculates the attribute at Index, syncs the dense arrays and broadcasts a value change if there was one.
+	// Inside a batch both steps are deferred to EndBatch.
+	void CommitAttribute(int32 Index, float OldValue);
+	void RecalculateIndex(int32 Index);
+	void BroadcastValueChange(int32 Index, float OldValue);
+
+	// Batch state
+	int32 BatchDepth = 0;
+	int32 BroadcastsSaved = 0;
+	int32 BatchDeferredChanges = 0;
+	TBitArray<> BatchDirty;
+	TBitArray<> BatchPending;
+	TArray<int32> BatchPendingIndices;
+	TArray<float> BatchPendingOldValues;
 };
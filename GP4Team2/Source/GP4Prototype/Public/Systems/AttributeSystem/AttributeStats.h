@@ -0,0 +1,13 @@
+﻿#pragma once
+
+#include "CoreMinimal.h"
+#include "Stats/Stats.h"
+
+// "stat Attributes"
+DECLARE_STATS_GROUP(TEXT("Attributes"), STATGROUP_Attributes, STATCAT_Advanced);
+
+DECLARE_CYCLE_STAT_EXTERN(TEXT("Initialize From Agent Data"), STAT_AttributeInit, STATGROUP_Attributes, GP4PROTOTYPE_API);
+DECLARE_CYCLE_STAT_EXTERN(TEXT("Bake Agent Data"), STAT_AttributeBake, STATGROUP_Attributes, GP4PROTOTYPE_API);
+
+DECLARE_DWORD_COUNTER_STAT_EXTERN(TEXT("Shared Template Inits"), STAT_AttributeSharedInits, STATGROUP_Attributes, GP4PROTOTYPE_API);
+DECLARE_DWORD_COUNTER_STAT_EXTERN(TEXT("Per-Instance Inits"), STAT_AttributeCopiedInits, STATGROUP_Attributes, GP4PROTOTYPE_API);
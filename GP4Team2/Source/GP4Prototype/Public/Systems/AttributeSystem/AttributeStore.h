@@ -0,0 +1,125 @@
+﻿#pragma once
+
+#include "CoreMinimal.h"
+#include "GameplayTagContainer.h"
+#include "DataStructures/AttributeUpgradeDataStructs.h"
+#include "Systems/AttributeSystem/AgentData.h"
+#include "Systems/AttributeSystem/AttributeTags.h"
+
+// Immutable attribute set shared by every component initialized from the same data.
+// Slots follow the FAttributeStore layout: natives at their EAttributeId index, then the data's extra tags.
+struct GP4PROTOTYPE_API FAttributeTemplate
+{
+	enum : uint8
+	{
+		Flag_Registered = 1 << 0,
+		Flag_Integer    = 1 << 1,
+	};
+
+	TArray<float> Values;
+	TArray<float> BaseValues;
+	TArray<uint8> Flags;
+	TArray<FGameplayTag> Tags;
+	TArray<FAttribute> Records;
+	TMap<FGameplayTag, int32> ExtraIndices;
+
+	// Slots set by the data, in bake order
+	TArray<int32> DataSlots;
+
+	int32 Num() const { return Records.Num(); }
+
+	// Slot of a tag in this template, or INDEX_NONE
+	int32 FindIndex(const FGameplayTag& Tag) const;
+
+	// True if this template's data sets every attribute Other's data sets, so switching from Other loses no value
+	bool SetsEveryAttributeOf(const FAttributeTemplate& Other) const;
+
+	// Every native attribute registered at zero; shared by components that have no data yet
+	static TSharedRef<const FAttributeTemplate> GetEmpty();
+
+	// Lays out pre-baked entries; no rounding, clamping or recalculation happens here
+	static TSharedRef<const FAttributeTemplate> Build(TConstArrayView<FAgentAttributeBaked> Entries);
+
+	static uint8 MakeFlags(const FAttribute& Record);
+
+private:
+	FAttributeTemplate();
+	int32 FindOrAddSlot(const FGameplayTag& Tag);
+};
+
+// Dense, index-addressed attribute storage used by UAttributeComponent.
+// Reads go straight to a shared FAttributeTemplate until the first write. Writes copy the small value/base/flag
+// arrays once, and copy only the touched FAttribute records into a sparse per-instance overlay, so components that
+// never receive a modifier own no attribute data at all.
+struct GP4PROTOTYPE_API FAttributeStore
+{
+	UE_NONCOPYABLE(FAttributeStore);
+
+	FAttributeStore();
+
+	// Shares InTemplate and drops all per-instance state
+	void SetTemplate(const TSharedRef<const FAttributeTemplate>& InTemplate);
+	const TSharedRef<const FAttributeTemplate>& GetTemplate() const { return Template; }
+
+	// True once this instance holds any state of its own
+	bool HasOverlay() const { return bOwnsHotData || OverlayRecords.Num() > 0; }
+
+	// Heap bytes owned by this instance on top of the shared template
+	SIZE_T GetOverlayAllocatedSize() const;
+
+	int32 Num() const { return NumSlots; }
+
+	// Index of a registered attribute, or INDEX_NONE
+	int32 FindIndex(const FGameplayTag& Tag) const;
+
+	// Index of the attribute, registering a new slot if needed
+	int32 FindOrAddIndex(const FGameplayTag& Tag);
+
+	bool IsRegistered(int32 Index) const { return (FlagData[Index] & FAttributeTemplate::Flag_Registered) != 0; }
+	bool IsInteger(int32 Index) const { return (FlagData[Index] & FAttributeTemplate::Flag_Integer) != 0; }
+	const FGameplayTag& GetTag(int32 Index) const;
+
+	// Read-only record; shared with the template unless this instance has written to it
+	const FAttribute& GetRecord(int32 Index) const;
+
+	// Writable record, copied into the overlay on first use. References stay valid until the next record is copied
+	// or a new tag is registered.
+	FAttribute& EditRecord(int32 Index);
+
+	// Registered record for a tag, or nullptr
+	const FAttribute* Find(const FGameplayTag& Tag) const;
+
+	float GetValue(int32 Index) const { return ValueData[Index]; }
+	float GetBaseValue(int32 Index) const { return BaseData[Index]; }
+	float GetValue(EAttributeId Id) const { return ValueData[static_cast<int32>(Id)]; }
+	float GetBaseValue(EAttributeId Id) const { return BaseData[static_cast<int32>(Id)]; }
+
+	// Copies the record's value, base and numeric type into the flat arrays. Call after every change to a record.
+	void Sync(int32 Index);
+
+	// Recalculates and syncs an overlay record; template records are baked and never out of date
+	void Recalculate(int32 Index);
+
+private:
+	void MakeHotDataUnique();
+	void RefreshDataPointers();
+
+	TSharedRef<const FAttributeTemplate> Template;
+
+	// Point at the template's arrays until the first write, then at this instance's copies
+	const float* ValueData = nullptr;
+	const float* BaseData = nullptr;
+	const uint8* FlagData = nullptr;
+	int32 NumSlots = 0;
+
+	// Per-instance overlay
+	bool bOwnsHotData = false;
+	TArray<float> Values;
+	TArray<float> BaseValues;
+	TArray<uint8> Flags;
+	TMap<int32, FAttribute> OverlayRecords;
+
+	// Tags registered on this instance only, in slots after the template's
+	TArray<FGameplayTag> ExtraTags;
+	TMap<FGameplayTag, int32> ExtraIndices;
+};
@@ -7,7 +7,55 @@
 // Centralized native declarations for all Attribute.* gameplay tags.
 // Using native tags ensures cooked builds work without relying on runtime registration.
 // Access via the variables or use FindTagByString to resolve from string names.
-// Access via the variables or use FindTagByString to resolve from string names.
+
+// Dense index of every native attribute, in declaration order. UAttributeComponent stores native attributes at these
+// indices, so hot paths can read them without hashing a tag. Keep in sync with the tag list below.
+enum class EAttributeId : uint8
+{
+	MaxHealth,
+	MaxDefense,
+
+	Dash_Cooldown,
+	Dash_CooldownPerCharge,
+	Dash_KnockbackForce,
+	Dash_KnockbackForceDead,
+	Dash_Strength,
+	Dash_MaxCharges,
+	Dash_CollisionDamage,
+
+	Killstreak_ExplosiveRounds,
+
+	Movement_WalkSpeed,
+	Movement_SprintSpeed,
+	Movement_CrouchSpeed,
+
+	Melee_Damage,
+	Melee_KnockbackForce,
+	Melee_KnockbackForceDead,
+	Melee_Cooldown,
+	Melee_HitDetection,
+	Melee_HitDetectionRadius,
+	Melee_SwingAmount,
+
+	Slide_Strength,
+	Slide_Duration,
+	Slide_Cooldown,
+	Slide_CollisionDamage,
+	Slide_ScopeTimeDilation,
+
+	SlowMo_TimeDilation,
+	SlowMo_MaxDuration,
+	SlowMo_Cooldown,
+
+	Throw_Force,
+	Throw_Damage,
+
+	Weapon_FireDelay,
+	Weapon_ReloadSpeed,
+	Weapon_Damage,
+
+	NumNative
+};
 
 namespace AttributeTags
 {
@@ -65,4 +113,10 @@ namespace AttributeTags
 
 	// Helper: map string name (e.g., "Attribute.MaxHealth") to the native FGameplayTag, or return Invalid if unknown.
 	GP4PROTOTYPE_API FGameplayTag FindTagByString(const FString& TagName);
+
+	// Native tag stored at the given dense index
+	GP4PROTOTYPE_API FGameplayTag GetNativeTag(EAttributeId Id);
+
+	// Dense index of a native attribute tag, or INDEX_NONE for tags outside the native table
+	GP4PROTOTYPE_API int32 FindNativeIndex(const FGameplayTag& Tag);
 }
@@ -4,13 +4,23 @@
 #include "GameFramework/Actor.h"
 #include "GameFramework/MovementComponent.h"
 #include "GameFramework/ProjectileMovementComponent.h"
+#include "ObjectPool/Poolable.h"
 #include "Bullet.generated.h"
 class UCombatEventsSubsystem;
+class UPooledActorComponent;
+class UNiagaraSystem;
+
+UENUM(BlueprintType)
+enum class EBulletHitDetection : uint8
+{
+	Overlap  UMETA(DisplayName = "Overlap", ToolTip = "Mesh overlap events; needs overlap generation on the bullet and every target"),
+	Sweep    UMETA(DisplayName = "Sweep", ToolTip = "One swept sphere per movement step; cannot tunnel through thin capsules")
+};
 
 DECLARE_DYNAMIC_MULTICAST_DELEGATE_EightParams(FOnHit, AActor*, HitActor, float, Damage, FName, HitSocketName, UPrimitiveComponent*, OverlappedComp, UPrimitiveComponent*, OtherComp, int32, OtherBodyIndex, bool, bFromSweep, const FHitResult&, SweepResult);
 
 UCLASS()
-class GP4PROTOTYPE_API ABullet : public AActor
+class GP4PROTOTYPE_API ABullet : public AActor, public IPoolable
 {
 	GENERATED_BODY()
 
@@ -22,10 +32,39 @@ public:
 	UFUNCTION()
 	void Init(UCombatEventsSubsystem* InCombatEventsSubsystem, float Damage, float MoveSpeed);
 
+	// Shared hit resolution for actor and simulated bullets: damages IDamageable targets and returns the hit bone/socket
+	static FName ApplyHitDamage(AActor* OtherActor, UPrimitiveComponent* OtherComp, const FHitResult& Hit, float Damage);
+
+	// Safe to call on the class default object (simulated bullets have no instance)
+	void SpawnImpactEffect(const UObject* WorldContextObject, const FVector& Location, const FRotator& Rotation) const;
+
+	bool UsesSweepHitDetection() const { return HitDetection == EBulletHitDetection::Sweep; }
+
+	// Rewires overlap events on a live bullet; movement picks the mode up on the next Init
+	void SetHitDetection(EBulletHitDetection InHitDetection);
+
+	// Sphere sweep from Start to End ignoring this bullet and its instigator
+	bool SweepForHit(const FVector& Start, const FVector& End, FHitResult& OutHit) const;
+
+	// Runs a sweep result through the same path as an overlap (damage, OnHit, impact, release)
+	void HandleSweepHit(const FHitResult& Hit);
+
+	// Per-class tuning read by UProjectileSimulationSubsystem from the CDO
+	UStaticMeshComponent* GetBulletMesh() const { return StaticMesh; }
+	float GetDamageMultiplier() const { return BulletSpecificDamageMultiplier; }
+	float GetSpeedMultiplier() const { return BulletSpecificSpeedMultiplier; }
+
+	// IPoolable
+	virtual void SetPooledComponent(UPooledActorComponent* InPooledComponent) override { PooledComponent = InPooledComponent; }
+	virtual UPooledActorComponent* GetPooledComponent() const override { return PooledComponent; }
+
 protected:
 	virtual void BeginPlay() override;
 	virtual void EndPlay(const EEndPlayReason::Type EndPlayReason) override;
 
+	// IPoolable
+	virtual void OnReleased_Implementation() override;
+
 
 	// variables --> editable values
 	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category="Values")
@@ -34,6 +73,19 @@ protected:
 	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category="Values")
 	float BulletSpecificSpeedMultiplier = 1.0f;
 
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category="Hit Detection")
+	EBulletHitDetection HitDetection = EBulletHitDetection::Overlap;
+
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category="Hit Detection", meta=(ClampMin="0.0", EditCondition="HitDetection==EBulletHitDetection::Sweep"))
+	float SweepRadius = 5.0f;
+
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category="Hit Detection", meta=(EditCondition="HitDetection==EBulletHitDetection::Sweep"))
+	TEnumAsByte<ECollisionChannel> SweepChannel = ECC_Camera;
+
+	// Spawned at the hit point from the Niagara component pool (auto-released when the effect completes)
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category="Effects")
+	TObjectPtr<UNiagaraSystem> ImpactEffect;
+
 	
 	// variables --> editable components
 	UPROPERTY(EditDefaultsOnly, BlueprintReadWrite)
@@ -56,6 +108,16 @@ protected:
 	UPROPERTY()
 	float BaseMoveSpeed;
 
+	// Pool back-reference, handed over by the pool when it spawns this bullet; null for bullets spawned outside a pool
+	UPROPERTY()
+	TObjectPtr<UPooledActorComponent> PooledComponent;
+
+	// Slot in UProjectileUpdateSubsystem while it moves this bullet, INDEX_NONE otherwise
+	int32 ProjectileUpdateIndex = INDEX_NONE;
+	friend class UProjectileUpdateSubsystem;
+
+	void StopBatchedUpdate();
+
 
 	// delegates
 	UPROPERTY(BlueprintAssignable)
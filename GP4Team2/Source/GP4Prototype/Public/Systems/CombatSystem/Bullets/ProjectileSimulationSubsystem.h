@@ -0,0 +1,121 @@
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Subsystems/WorldSubsystem.h"
+#include "Systems/CombatSystem/Bullets/Bullet.h"
+#include "ProjectileSimulationSubsystem.generated.h"
+
+class UInstancedStaticMeshComponent;
+
+// Everything a simulated shot needs, filled in by the firing code
+struct FProjectileSpawnParams
+{
+	TSubclassOf<ABullet> BulletClass;
+	FVector Origin = FVector::ZeroVector;
+	FVector Direction = FVector::ForwardVector;
+
+	// Already scaled by the bullet class multipliers, same as ABullet::Init
+	float Damage = 0.f;
+	float Speed = 0.f;
+
+	float Radius = 5.f;
+	float Lifetime = 5.f;
+	ECollisionChannel TraceChannel = ECC_Camera;
+
+	AActor* Owner = nullptr;
+	AActor* Instigator = nullptr;
+};
+
+// One in-flight round. Hot fields first; the whole array is walked once per frame
+struct FSimulatedProjectile
+{
+	FVector Location = FVector::ZeroVector;
+	FVector Velocity = FVector::ZeroVector;
+	float Damage = 0.f;
+	float Radius = 0.f;
+	float RemainingLifetime = 0.f;
+	TEnumAsByte<ECollisionChannel> TraceChannel = ECC_Camera;
+
+	TWeakObjectPtr<AActor> Owner;
+	TWeakObjectPtr<AActor> Instigator;
+};
+
+// All rounds of one bullet class share a contiguous array and one instanced mesh
+USTRUCT()
+struct FProjectileGroup
+{
+	GENERATED_BODY()
+
+	UPROPERTY()
+	TSubclassOf<ABullet> BulletClass;
+
+	UPROPERTY()
+	TObjectPtr<UInstancedStaticMeshComponent> Mesh;
+
+	// Bullet mesh offset/scale from the class default object, applied to every instance
+	FTransform MeshRelativeTransform;
+
+	TArray<FSimulatedProjectile> Projectiles;
+};
+
+/**
+ * Actor-free bullet simulation. Rounds are structs advanced in one batched pass per frame with a swept sphere
+ * each, hits are resolved after the pass through ABullet::ApplyHitDamage, and each bullet class renders through
+ * one instanced static mesh. Thousands of rounds cost one tick instead of thousands of actor ticks and overlaps.
+ */
+UCLASS()
+class GP4PROTOTYPE_API UProjectileSimulationSubsystem : public UTickableWorldSubsystem
+{
+	GENERATED_BODY()
+
+public:
+	virtual void Deinitialize() override;
+
+	// UTickableWorldSubsystem: only ticks while rounds are in flight
+	virtual void Tick(float DeltaTime) override;
+	virtual bool IsTickable() const override { return NumLiveProjectiles > 0; }
+	virtual ETickableTickType GetTickableTickType() const override { return IsTemplate() ? ETickableTickType::Never : ETickableTickType::Conditional; }
+	virtual TStatId GetStatId() const override { RETURN_QUICK_DECLARE_CYCLE_STAT(UProjectileSimulationSubsystem, STATGROUP_Tickables); }
+
+	void SpawnProjectile(const FProjectileSpawnParams& Params);
+
+	// Drops every round without resolving hits (floor transitions, death)
+	UFUNCTION(BlueprintCallable, Category="Projectiles")
+	void ClearProjectiles();
+
+	UFUNCTION(BlueprintPure, Category="Projectiles")
+	int32 GetNumLiveProjectiles() const { return NumLiveProjectiles; }
+
+	// Same payload ABullet::OnHit broadcasts; OverlappedComp is always null since there is no bullet mesh
+	UPROPERTY(BlueprintAssignable, Category="Projectiles")
+	FOnHit OnProjectileHit;
+
+private:
+	struct FPendingHit
+	{
+		FHitResult Hit;
+		float Damage = 0.f;
+		int32 GroupIndex = INDEX_NONE;
+	};
+
+	int32 FindOrAddGroup(TSubclassOf<ABullet> BulletClass);
+	void EnsureRenderActor();
+	void SimulateGroup(FProjectileGroup& Group, int32 GroupIndex, float DeltaTime);
+	void ResolvePendingHits();
+	void UpdateGroupInstances(FProjectileGroup& Group);
+
+	UPROPERTY()
+	TArray<FProjectileGroup> Groups;
+
+	// Owns the instanced mesh components; transient and never saved
+	UPROPERTY()
+	TObjectPtr<AActor> RenderActor;
+
+	// Hits collected during the sweep pass, resolved after it so damage never runs mid-iteration
+	TArray<FPendingHit> PendingHits;
+
+	// Reused every frame for instance transforms
+	TArray<FTransform> InstanceScratch;
+
+	int32 NumLiveProjectiles = 0;
+};
@@ -0,0 +1,58 @@
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Subsystems/WorldSubsystem.h"
+#include "ProjectileUpdateSubsystem.generated.h"
+
+class ABullet;
+
+/**
+ * Moves every live actor bullet in one loop instead of one actor tick plus one movement component tick each.
+ * Positions are integrated in flat arrays (optionally with ParallelFor), then written back to the actors on the
+ * game thread with a swept move so overlap events fire along the whole step. Bullets using sweep hit detection are swept from their old to their new
+ * location in the same pass and all hits are resolved together afterwards. Toggle with GP4.Projectiles.BatchedUpdate / GP4.Projectiles.ParallelUpdate.
+ */
+UCLASS()
+class GP4PROTOTYPE_API UProjectileUpdateSubsystem : public UTickableWorldSubsystem
+{
+	GENERATED_BODY()
+
+public:
+	virtual void Deinitialize() override;
+
+	// UTickableWorldSubsystem: only ticks while bullets are registered
+	virtual void Tick(float DeltaTime) override;
+	virtual bool IsTickable() const override { return Bullets.Num() > 0; }
+	virtual ETickableTickType GetTickableTickType() const override { return IsTemplate() ? ETickableTickType::Never : ETickableTickType::Conditional; }
+	virtual TStatId GetStatId() const override { RETURN_QUICK_DECLARE_CYCLE_STAT(UProjectileUpdateSubsystem, STATGROUP_Tickables); }
+
+	// False when GP4.Projectiles.BatchedUpdate is 0; bullets then keep their own tick
+	static bool IsBatchingEnabled();
+
+	// Takes over the bullet's movement: straight along its current forward vector at Speed
+	void RegisterBullet(ABullet* Bullet, float Speed);
+	void UnregisterBullet(ABullet* Bullet);
+
+	int32 GetNumRegistered() const { return Bullets.Num(); }
+
+private:
+	// Parallel arrays indexed like Bullets; removal is swap-based and patched through ABullet::ProjectileUpdateIndex
+	UPROPERTY()
+	TArray<TObjectPtr<ABullet>> Bullets;
+
+	TArray<FVector> Locations;
+	TArray<FVector> Directions;
+	TArray<float> Speeds;
+	TArray<bool> Sweeps;
+
+	struct FPendingBulletHit
+	{
+		TWeakObjectPtr<ABullet> Bullet;
+		FHitResult Hit;
+	};
+
+	// Collected during the move pass; resolving releases bullets, which reshuffles the arrays above
+	TArray<FPendingBulletHit> PendingHits;
+
+	void RemoveAtIndex(int32 Index);
+};
@@ -6,12 +6,16 @@
 #include "Components/ActorComponent.h"
 #include "Systems/CombatSystem/CombatEventsSubsystem.h"
 #include "Core/Data/Structs/CombatContext.h"
+#include "Core/Data/Enums/BulletSimulationMode.h"
 #include "Core/Subsystems/LookTraceSubsystem.h"
+#include "ObjectPool/ObjectPoolBase.h"
+#include "ObjectPool/PoolHandle.h"
 #include "CombatComponent.generated.h"
 
 
 class UAttributeComponent;
 class UObjectPoolSubsystem;
+class UProjectileSimulationSubsystem;
 DECLARE_DYNAMIC_MULTICAST_DELEGATE(FOnCombatInteraction);
 DECLARE_DYNAMIC_MULTICAST_DELEGATE_OneParam(FOnMeleeHit, USkeletalMeshComponent*, SkelMesh);
 DECLARE_DYNAMIC_MULTICAST_DELEGATE_FourParams(FOnRecharge, float, CurrentFireRechargeValue, float, MaxFireRechargeValue, bool, RechargingFromFullDepletion,
@@ -165,6 +169,24 @@ protected:
 
 	UPROPERTY(EditDefaultsOnly, BlueprintReadWrite, Category="Fire|Pooling", meta=(ClampMin="0"))
 	int32 BulletPoolInitialSize = 100;
+
+	// Opt-in: bullet pools warm up across frames and grow in the background ahead of demand. Off keeps the up-front prewarm
+	UPROPERTY(EditDefaultsOnly, BlueprintReadWrite, Category="Fire|Pooling")
+	FPoolGrowthPolicy BulletPoolGrowth;
+
+	// Opt-in: bullet pools shrink back after a horde instead of keeping their peak size for the rest of the run
+	UPROPERTY(EditDefaultsOnly, BlueprintReadWrite, Category="Fire|Pooling")
+	FPoolTrimPolicy BulletPoolTrim;
+
+	// Simulated skips bullet actors entirely: rounds are swept structs rendered with the bullet's mesh as instances
+	UPROPERTY(EditDefaultsOnly, BlueprintReadWrite, Category="Fire|Simulation")
+	EBulletSimulationMode BulletSimulationMode = EBulletSimulationMode::Actor;
+
+	UPROPERTY(EditDefaultsOnly, BlueprintReadWrite, Category="Fire|Simulation", meta=(ClampMin="0.0", EditCondition="BulletSimulationMode==EBulletSimulationMode::Simulated"))
+	float SimulatedBulletRadius = 5.0f;
+
+	UPROPERTY(EditDefaultsOnly, BlueprintReadWrite, Category="Fire|Simulation", meta=(ClampMin="0.01", EditCondition="BulletSimulationMode==EBulletSimulationMode::Simulated"))
+	float SimulatedBulletLifetime = 5.0f;
 	
 	
 	// variables --> edit, recharge / reload state
@@ -309,8 +331,25 @@ protected:
 	UPROPERTY()
 	ULookTraceSubsystem* LookTraceSubsystem = nullptr;
 
+	// Aim point is traced async every frame while fire is held; Fire uses it when it is at most a frame old
+	FLookTraceHandle AimTraceHandle;
+	FVector AsyncAimPoint = FVector::ZeroVector;
+	uint64 AsyncAimPointFrame = 0;
+
+	void TickAsyncAimTrace();
+	FVector GetAimPoint();
+
 	UPROPERTY()
 	UObjectPoolSubsystem* PoolSubsystem = nullptr;
+
+	UPROPERTY()
+	UProjectileSimulationSubsystem* ProjectileSimulation = nullptr;
+
+	UPROPERTY()
+	FPoolHandle StandardBulletPool;
+
+	UPROPERTY()
+	FPoolHandle OneShotBulletPool;
 	
 	// methods
 	UFUNCTION()
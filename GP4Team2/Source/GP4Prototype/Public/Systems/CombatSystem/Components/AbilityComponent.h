@@ -3,9 +3,12 @@
 #include "CoreMinimal.h"
 #include "Components/ActorComponent.h"
 #include "Kismet/KismetSystemLibrary.h"
+#include "ObjectPool/ObjectPoolTemplate.h"
 #include "Systems/CombatSystem/Abilities/GameplayAbilityObject.h"
 #include "AbilityComponent.generated.h"
 
+class UAudioComponent;
+
 
 UCLASS(ClassGroup=(Custom), meta=(BlueprintSpawnableComponent), Blueprintable)
 class GP4PROTOTYPE_API UAbilityComponent : public UActorComponent
@@ -61,12 +64,20 @@ public:
 	UFUNCTION(BlueprintCallable, Category="Ability")
 	AActor* SpawnActorForAbility(TSubclassOf<AActor> Class, const FTransform& Xform, ESpawnActorCollisionHandlingMethod Handling = ESpawnActorCollisionHandlingMethod::AlwaysSpawn);
 
+	// Plays through a pooled 2D audio component; the component goes back to the pool when the sound finishes
 	UFUNCTION(BlueprintCallable, Category="Ability")
 	void PlaySound2D(USoundBase* Sound, UAudioComponent*& OutAudioComp);
+
+	static void AddReferencedObjects(UObject* InThis, FReferenceCollector& Collector);
 	
 
 protected:
 	virtual void BeginPlay() override;
+	virtual void EndPlay(const EEndPlayReason::Type EndPlayReason) override;
+
+	// Audio components created up front for PlaySound2D; grows by one when every component is busy
+	UPROPERTY(EditDefaultsOnly, BlueprintReadOnly, Category="Audio")
+	int32 SoundPoolSize = 4;
 
 	// variables --> editable, static values
 	UPROPERTY(EditDefaultsOnly, BlueprintReadWrite, Category="General")
@@ -103,4 +114,10 @@ protected:
 
 	UFUNCTION()
 	void TickCurrentPassiveAbilitiesCooldown(float DeltaTime);
+
+private:
+	TUniquePtr<TObjectPool<UAudioComponent>> SoundPool;
+
+	UAudioComponent* CreatePooledSound();
+	void OnPooledSoundFinished(UAudioComponent* AudioComp);
 };
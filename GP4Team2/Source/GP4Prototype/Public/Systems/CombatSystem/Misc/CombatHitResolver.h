@@ -0,0 +1,59 @@
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Core/Data/Enums/GameDamageType.h"
+
+class USkeletalMeshComponent;
+
+// What one swing (melee, dash or slide) does to each victim; read from attributes once when it starts
+struct FCombatHitParams
+{
+	EGameDamageType DamageType = EGameDamageType::Melee;
+	float Damage = 0.f;
+	int32 MaxHits = 1;
+
+	// survivors are launched away (horizontal + upward), dying ones get a ragdoll impulse
+	float KnockbackForce = 0.f;
+	float KnockbackUpward = 0.f;
+	float KnockbackForceDead = 0.f;
+};
+
+/**
+ * Shared hit resolution for melee, dash and slide hits. BeginSwing sets the instigator and the swing's values, then
+ * every sweep result of the swing goes through ResolveHits in one pass: the instigator, non-damageable classes,
+ * actors already hit this swing and anything past the swing's hit capacity are dropped, survivors take damage and
+ * knockback. Dedup is a set, damageable checks and damageable skeletal mesh lookups are cached per class, so a
+ * swing through a crowd costs one lookup per new victim instead of several per hit.
+ */
+class GP4PROTOTYPE_API FCombatHitResolver
+{
+public:
+	void BeginSwing(AActor* InInstigator, const FCombatHitParams& InParams);
+
+	// Applies the swing to every new victim in Hits; OnVictim runs after the damage, before the knockback, also for
+	// victims the damage destroyed. Returns the number of new victims
+	int32 ResolveHits(TConstArrayView<FHitResult> Hits, TFunctionRef<void(AActor* Victim)> OnVictim);
+	int32 ResolveHits(TConstArrayView<FHitResult> Hits);
+
+	// The victim's skeletal mesh tagged "DamageableSkelMesh" (hit reactions play on it), or null
+	USkeletalMeshComponent* FindDamageableSkelMesh(AActor* Actor);
+
+	bool IsDamageableClass(const UClass* Class);
+
+	int32 GetNumHitThisSwing() const { return HitThisSwing.Num(); }
+	bool HasHitThisSwing(const AActor* Actor) const { return HitThisSwing.Contains(Actor); }
+
+private:
+	void KnockbackLiving(AActor* Victim) const;
+	void KnockbackDead(AActor* Victim) const;
+
+	TWeakObjectPtr<AActor> Instigator;
+	FCombatHitParams Params;
+	TSet<TObjectKey<AActor>> HitThisSwing;
+
+	TMap<TObjectKey<UClass>, bool> DamageableByClass;
+
+	// Name of the tagged skeletal mesh per class (NAME_None when the class has none); components keep their
+	// template name on every instance, so later victims of the class skip the component scan
+	TMap<TObjectKey<UClass>, FName> DamageableSkelMeshByClass;
+};
@@ -3,10 +3,12 @@
 #include "CoreMinimal.h"
 #include "Core/ReusableSystems/FiniteStateMachine/BaseCombatState.h"
 #include "Core/Subsystems/LookTraceSubsystem.h"
+#include "Systems/CombatSystem/Misc/CombatHitResolver.h"
 #include "MeleeState.generated.h"
 class UAttributeComponent;
 class UCombatFiniteStateMachine;
 class UCombatComponent;
+class UEnemyBroadphaseSubsystem;
 
 UCLASS()
 class GP4PROTOTYPE_API UMeleeState : public UBaseCombatState
@@ -111,8 +113,10 @@ protected:
 	UPROPERTY()
 	FVector PrevTip;
 
-	UPROPERTY()
-	TArray<AActor*> DamagedActors;
+	FCombatHitResolver HitResolver;
+
+	// reused every active frame so the swing trace never allocates
+	FTraceHitBuffer MeleeHits;
 
 	
 	// variables --> components
@@ -128,6 +132,9 @@ protected:
 	UPROPERTY()
 	ULookTraceSubsystem* LookTraceSubsystem;
 
+	UPROPERTY()
+	UEnemyBroadphaseSubsystem* EnemyBroadphase;
+
 	UPROPERTY()
 	AController* Controller;
 
@@ -140,11 +147,7 @@ protected:
 
 	// methods
 	UFUNCTION()
-	void OnMeleeHit(FHitResult Hit);
+	void OnMeleeHit(const FHitResult& Hit);
 
-	UFUNCTION()
-	void KnockbackLiving(AActor* HitActor);
-
-	UFUNCTION()
-	void KnockbackDead(AActor* HitActor);
+	int32 ResolveMeleeHits(TConstArrayView<FHitResult> Hits);
 };
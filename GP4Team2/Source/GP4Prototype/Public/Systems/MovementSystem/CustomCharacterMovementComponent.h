@@ -3,7 +3,9 @@
 #include "CoreMinimal.h"
 #include "Components/ActorComponent.h"
 #include "GP4Prototype/Public/Core/Data/Structs/MovementContext.h"
+#include "Core/Subsystems/LookTraceSubsystem.h"
 #include "Systems/AttributeSystem/AttributeComponent.h"
+#include "Systems/MovementSystem/MovementProbeScheduler.h"
 #include "CustomCharacterMovementComponent.generated.h"
 class UMovementFiniteStateMachine;
 class UBaseMovementFiniteStateMachine;
@@ -55,6 +57,17 @@ public:
 	UFUNCTION()
 	void OnSlideVaultExecuted();
 
+	// methods --> movement probes
+	// Forward probe through the adaptive scheduler; true with OutHit while geometry is within TraceLength ahead.
+	// Async probes answer from the frame after they are issued
+	bool ProbeForward(EMovementProbe Probe, float TraceLength, float TraceRadius, ECollisionChannel TraceChannel, bool bAsync, FHitResult& OutHit);
+
+	// Drops the probe's last result and any trace still in flight (state exit)
+	void ResetProbe(EMovementProbe Probe);
+
+	UFUNCTION(BlueprintPure, Category="Movement, Vault Probe")
+	void GetProbeStats(EMovementProbe Probe, int32& OutProbes, int32& OutReuses) const;
+
 	
 	// delegates
 	UPROPERTY(BlueprintAssignable, meta = (ToolTip = "Walk state covers both idle and normal speed walking"))
@@ -251,6 +264,19 @@ protected:
 	UPROPERTY(EditDefaultsOnly, BlueprintReadWrite, Category="Movement, Vault")
 	float DashToVaultHeightRequirement = 500.0f;
 
+	// variables --> edit, vault probe scheduling
+	UPROPERTY(EditDefaultsOnly, BlueprintReadWrite, Category="Movement, Vault Probe")
+	float VaultProbeMinInterval = 0.02f;
+
+	UPROPERTY(EditDefaultsOnly, BlueprintReadWrite, Category="Movement, Vault Probe")
+	float VaultProbeMaxInterval = 0.1f;
+
+	UPROPERTY(EditDefaultsOnly, BlueprintReadWrite, Category="Movement, Vault Probe")
+	float VaultProbeReuseDistance = 10.0f;
+
+	UPROPERTY(EditDefaultsOnly, BlueprintReadWrite, Category="Movement, Vault Probe")
+	float VaultProbeReuseAngle = 5.0f;
+
 	
 	// variables --> hidden, dynamic
 	UPROPERTY(BlueprintReadOnly, Category="Movement, Dash")
@@ -282,6 +308,22 @@ protected:
 	UPROPERTY()
 	UAttributeComponent* AttributeComponent = nullptr;
 
+	UPROPERTY()
+	ULookTraceSubsystem* LookTraceSubsystem = nullptr;
+
+	// vault probes
+	struct FPendingProbe
+	{
+		FLookTraceHandle Handle;
+		double Time = 0.0;
+		FVector Origin = FVector::ZeroVector;
+		FVector Forward = FVector::ForwardVector;
+		float Speed = 0.f;
+	};
+
+	FMovementProbeScheduler ProbeScheduler;
+	TStaticArray<FPendingProbe, FMovementProbeScheduler::NumProbeSlots> PendingProbes;
+
 
 	// methods
 	UFUNCTION()
@@ -0,0 +1,74 @@
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Containers/StaticArray.h"
+#include "Core/Data/Enums/MovementProbe.h"
+#include "Engine/HitResult.h"
+
+struct FMovementProbeSettings
+{
+	// a probe with geometry close ahead is refreshed at most this often
+	float MinInterval = 0.02f;
+
+	// and every probe at least this often, for geometry that moves
+	float MaxInterval = 0.1f;
+
+	// movement (along or across the probe line) below which the last result is reused as is
+	float ReuseDistance = 10.f;
+
+	// turning further than this invalidates the last result
+	float ReuseAngleDegrees = 5.f;
+};
+
+/**
+ * Decides when the forward vault probes of the movement states actually trace. Each probe traces further than its
+ * reach (enough for the ground covered until the next probe), so between probes the last hit, shifted by how far the
+ * pawn moved along the probe line, tells exactly when geometry comes into reach. Probes refresh sooner the closer
+ * that geometry is, and immediately once the pawn turns, strafes off the line or outruns the traced distance.
+ * Holds no engine state; UCustomCharacterMovementComponent issues the traces.
+ */
+class GP4PROTOTYPE_API FMovementProbeScheduler
+{
+public:
+	void SetSettings(const FMovementProbeSettings& InSettings) { Settings = InSettings; }
+	const FMovementProbeSettings& GetSettings() const { return Settings; }
+
+	// False while the last result of Probe still describes what is ahead of Location/Forward (counted as a reuse)
+	bool ShouldProbe(EMovementProbe Probe, double Now, const FVector& Location, const FVector& Forward);
+
+	// How far to trace so the result stays valid until the next probe at Speed
+	float GetLookaheadLength(float TraceLength, float Speed) const;
+
+	// Stores a probe traced from Origin along Forward with GetLookaheadLength(TraceLength, Speed) and schedules the next one
+	void RecordProbe(EMovementProbe Probe, double Now, const FVector& Origin, const FVector& Forward, float Speed, float TraceLength, const FHitResult& Hit);
+
+	// The last hit of Probe if it is within TraceLength of Location; Distance is measured from Location
+	bool GetHitInRange(EMovementProbe Probe, const FVector& Location, float TraceLength, FHitResult& OutHit) const;
+
+	void Invalidate(EMovementProbe Probe);
+
+	int32 GetNumProbes(EMovementProbe Probe) const { return Slots[static_cast<int32>(Probe)].NumProbes; }
+	int32 GetNumReuses(EMovementProbe Probe) const { return Slots[static_cast<int32>(Probe)].NumReuses; }
+	void ResetStats();
+
+	static constexpr int32 NumProbeSlots = static_cast<int32>(EMovementProbe::MAX);
+
+private:
+	struct FProbeSlot
+	{
+		bool bValid = false;
+		double NextProbeTime = 0.0;
+		FVector Origin = FVector::ZeroVector;
+		FVector Forward = FVector::ForwardVector;
+
+		// distance past the probe's reach that the trace covered
+		float CoveredAhead = 0.f;
+		FHitResult Hit;
+
+		int32 NumProbes = 0;
+		int32 NumReuses = 0;
+	};
+
+	FMovementProbeSettings Settings;
+	TStaticArray<FProbeSlot, NumProbeSlots> Slots;
+};
@@ -2,10 +2,12 @@
 
 #include "CoreMinimal.h"
 #include "Core/ReusableSystems/FiniteStateMachine/BaseMoveState.h"
+#include "Systems/CombatSystem/Misc/CombatHitResolver.h"
 #include "DashState.generated.h"
 class UCapsuleComponent;
 class UAttributeComponent;
 class ULookTraceSubsystem;
+class UEnemyBroadphaseSubsystem;
 class UCharacterMovementComponent;
 class UCustomCharacterMovementComponent;
 class UMovementFiniteStateMachine;
@@ -113,6 +115,9 @@ protected:
 	UPROPERTY()
 	ULookTraceSubsystem* LookTraceSubsystem;
 
+	UPROPERTY()
+	UEnemyBroadphaseSubsystem* EnemyBroadphase;
+
 	// variables --> editable, melee dash stuff
 	UPROPERTY()
 	int MaxDashHitCapacity;
@@ -131,8 +136,7 @@ protected:
 
 	
 	// variables --> hidden, melee dash stuff
-	UPROPERTY()
-	TArray<AActor*> DamagedActors;
+	FCombatHitResolver HitResolver;
 
 
 	// methods
@@ -148,10 +152,6 @@ protected:
 	// methods --> extra stuff
 	UFUNCTION()
 	void TryDashHit();
-	UFUNCTION()
-	void KnockbackLiving(AActor* HitActor);
-	UFUNCTION()
-	void KnockbackDead(AActor* HitActor);
 
 	bool TryVaultTransition(FMovementContext Context);
 };
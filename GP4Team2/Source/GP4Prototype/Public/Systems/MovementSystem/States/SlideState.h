@@ -2,10 +2,12 @@
 
 #include "CoreMinimal.h"
 #include "Core/ReusableSystems/FiniteStateMachine/BaseMoveState.h"
+#include "Systems/CombatSystem/Misc/CombatHitResolver.h"
 #include "SlideState.generated.h"
 
 
 class ULookTraceSubsystem;
+class UEnemyBroadphaseSubsystem;
 class UAttributeComponent;
 class UCustomCharacterMovementComponent;
 class UCharacterMovementComponent;
@@ -88,6 +90,9 @@ protected:
 	UPROPERTY()
 	ULookTraceSubsystem* LookTraceSubsystem;
 
+	UPROPERTY()
+	UEnemyBroadphaseSubsystem* EnemyBroadphase;
+
 
 	// variables --> editable, melee dash stuff
 	UPROPERTY()
@@ -117,17 +122,10 @@ protected:
 
 	
 	// variables --> hidden, melee dash stuff
-	UPROPERTY()
-	TArray<AActor*> DamagedActors;
+	FCombatHitResolver HitResolver;
 
 
 	// methods --> melee stuff
 	UFUNCTION()
 	void TryDashHit();
-	
-	UFUNCTION()
-	void KnockbackLiving(AActor* HitActor);
-
-	UFUNCTION()
-	void KnockbackDead(AActor* HitActor);
 };
@@ -2,6 +2,7 @@
 
 #include "CoreMinimal.h"
 #include "Core/ReusableSystems/FiniteStateMachine/BaseMoveState.h"
+#include "Core/Subsystems/LookTraceSubsystem.h"
 #include "SprintState.generated.h"
 
 
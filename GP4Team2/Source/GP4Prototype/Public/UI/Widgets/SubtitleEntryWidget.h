@@ -4,13 +4,16 @@
 
 #include "CoreMinimal.h"
 #include "Blueprint/UserWidget.h"
+#include "ObjectPool/Poolable.h"
 #include "SubtitleEntryWidget.generated.h"
 
+class USubtitleWidget;
+
 /**
  * 
  */
 UCLASS()
-class GP4PROTOTYPE_API USubtitleEntryWidget : public UUserWidget
+class GP4PROTOTYPE_API USubtitleEntryWidget : public UUserWidget, public IPoolable
 {
 	GENERATED_BODY()
 
@@ -27,6 +30,18 @@ public:
 	UPROPERTY(BlueprintReadWrite, Transient, meta = (BindWidgetAnim))
 	UWidgetAnimation* FadeOut;
 
-	// Main destroy logic that plays animation first.
+	// Main destroy logic that plays animation first. Pooled entries go back to their widget instead of being dropped
 	void PlayFadeOutAndDestroy();
+
+	// Set by the pool factory in USubtitleWidget
+	TWeakObjectPtr<USubtitleWidget> OwningSubtitleWidget;
+
+protected:
+	// IPoolable
+	virtual void OnReleased_Implementation() override;
+
+private:
+	void FinishFadeOut();
+
+	FTimerHandle FadeOutTimerHandle;
 };
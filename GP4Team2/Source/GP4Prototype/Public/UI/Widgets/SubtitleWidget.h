@@ -4,6 +4,7 @@
 
 #include "CoreMinimal.h"
 #include "Blueprint/UserWidget.h"
+#include "ObjectPool/ObjectPoolTemplate.h"
 #include "SubtitleWidget.generated.h"
 
 class UVerticalBox;
@@ -34,9 +35,25 @@ public:
 	USubtitleEntryWidget* AddSubtitle(const FText& Speaker, const FText& Line);
 
 	// Removes oldest (if you want a max limit)
-	void CullOldEntries() const;
+	void CullOldEntries();
 
 	// Clears all active subtitle entries immediately
 	UFUNCTION(BlueprintCallable, Category="Subtitles")
 	void ClearAllSubtitles();
+
+	// Takes the entry off screen and hands it back to the entry pool (entries not from this widget are just removed)
+	void ReleaseEntry(USubtitleEntryWidget* Entry);
+
+	static void AddReferencedObjects(UObject* InThis, FReferenceCollector& Collector);
+
+protected:
+	// Entries kept around for reuse, on top of MaxEntryAmount
+	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category="Subtitles")
+	int32 EntryPoolSize = 4;
+
+private:
+	// Created on first use so EntryClass can be set from BP defaults
+	TUniquePtr<TObjectPool<USubtitleEntryWidget>> EntryPool;
+
+	USubtitleEntryWidget* AcquireEntry();
 };